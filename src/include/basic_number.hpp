@@ -2,6 +2,11 @@
 #define BASIC_NUMBER_HPP
 
 #include "basic_number_core.hpp"
+#include "basic_number_lazy.hpp"
+#include "basic_number_limits.hpp"
+#include "basic_number_scale.hpp"
 #include "basic_number_streams.hpp"
+#include "basic_number_span.hpp"
+#include "divisor.hpp"
 
 #endif
@@ -0,0 +1,273 @@
+#ifndef BASIC_NUMBER_ATOMIC_HPP
+#define BASIC_NUMBER_ATOMIC_HPP
+
+#include <atomic>
+#include <type_traits>
+
+#include "basic_number_core.hpp"
+
+// Not included by basic_number.hpp, so that only the users of the atomics parse
+// <atomic>.
+
+namespace std{
+
+/**
+ * @brief An atomic basic_number, that is lock-free whenever std::atomic<T> is.
+ *
+ * The number is stored as a std::atomic<T>, so that the values that are loaded and
+ * stored keep their type while the operations are those of T. fetch_add, fetch_sub,
+ * += and -= exist with ENABLE_SPECIFIC_PLUS_MINUS and ++ and -- with ENABLE_INC_DEC,
+ * like the operators of the number. For integers they are single atomic
+ * instructions; with ENABLE_OVERFLOW_CHECK or for a T without an atomic fetch_add,
+ * like safe_int, they are loops of compare_exchange_weak around the operator of the
+ * number, so that overflows are checked as usual and the value is left unchanged if
+ * the operator throws. fetch_update() runs such a loop for any function.
+ *
+ * Every operation takes its std::memory_order; as with std::atomic the default and
+ * the order of the operators is std::memory_order_seq_cst.
+ */
+template<typename T, class Tid, type_builder::flag_t Tflags, template<typename, class> class Tbase>
+struct atomic<type_builder::basic_number<T, Tid, Tflags, Tbase>>{
+	private:
+		using number = type_builder::basic_number<T, Tid, Tflags, Tbase>;
+
+		static_assert((Tflags & type_builder::DISABLE_MUTABILITY) == 0,
+				"You cannot change the value of an instance of an immutable type");
+		static_assert(sizeof(number) == sizeof(T),
+				"only numbers that consist of their value can be atomic");
+
+		// whether the arithmetic is the one of std::atomic<T> rather than a loop:
+		using native = std::integral_constant<bool,
+			std::is_integral<T>::value && !std::is_same<T, bool>::value
+				&& (Tflags & type_builder::ENABLE_OVERFLOW_CHECK) == 0>;
+
+		std::atomic<T> value;
+
+		number fetch_add(const number& arg, memory_order order, std::true_type) noexcept{
+			return number{value.fetch_add(arg.get_value(), order)};
+		}
+
+		number fetch_add(const number& arg, memory_order order, std::false_type){
+			return fetch_update([&arg](number current){
+				current += arg;
+				return current;
+			}, order);
+		}
+
+		number fetch_sub(const number& arg, memory_order order, std::true_type) noexcept{
+			return number{value.fetch_sub(arg.get_value(), order)};
+		}
+
+		number fetch_sub(const number& arg, memory_order order, std::false_type){
+			return fetch_update([&arg](number current){
+				current -= arg;
+				return current;
+			}, order);
+		}
+
+		number add(const number& arg, std::true_type) noexcept{
+			return number{value += arg.get_value()};
+		}
+
+		number add(const number& arg, std::false_type){
+			number result = fetch_add(arg, memory_order_seq_cst, std::false_type{});
+			result += arg;
+			return result;
+		}
+
+		number subtract(const number& arg, std::true_type) noexcept{
+			return number{value -= arg.get_value()};
+		}
+
+		number subtract(const number& arg, std::false_type){
+			number result = fetch_sub(arg, memory_order_seq_cst, std::false_type{});
+			result -= arg;
+			return result;
+		}
+
+		number increment(std::true_type) noexcept{
+			return number{++value};
+		}
+
+		number increment(std::false_type){
+			number result = fetch_update([](number current){
+				++current;
+				return current;
+			});
+			return ++result;
+		}
+
+		number post_increment(std::true_type) noexcept{
+			return number{value++};
+		}
+
+		number post_increment(std::false_type){
+			return fetch_update([](number current){
+				++current;
+				return current;
+			});
+		}
+
+		number decrement(std::true_type) noexcept{
+			return number{--value};
+		}
+
+		number decrement(std::false_type){
+			number result = fetch_update([](number current){
+				--current;
+				return current;
+			});
+			return --result;
+		}
+
+		number post_decrement(std::true_type) noexcept{
+			return number{value--};
+		}
+
+		number post_decrement(std::false_type){
+			return fetch_update([](number current){
+				--current;
+				return current;
+			});
+		}
+
+	public:
+		using value_type = number;
+
+#if defined(__cpp_lib_atomic_is_always_lock_free)
+		static constexpr bool is_always_lock_free = std::atomic<T>::is_always_lock_free;
+#endif
+
+		atomic() noexcept = default;
+
+		constexpr atomic(number desired) noexcept: value(desired.get_value()){}
+
+		atomic(const atomic&) = delete;
+		atomic& operator=(const atomic&) = delete;
+
+		number operator=(number desired) noexcept{
+			store(desired);
+			return desired;
+		}
+
+		operator number() const noexcept{
+			return load();
+		}
+
+		bool is_lock_free() const noexcept{
+			return value.is_lock_free();
+		}
+
+		void store(number desired, memory_order order = memory_order_seq_cst) noexcept{
+			value.store(desired.get_value(), order);
+		}
+
+		number load(memory_order order = memory_order_seq_cst) const noexcept{
+			return number{value.load(order)};
+		}
+
+		number exchange(number desired, memory_order order = memory_order_seq_cst) noexcept{
+			return number{value.exchange(desired.get_value(), order)};
+		}
+
+		bool compare_exchange_weak(number& expected, number desired,
+				memory_order success, memory_order failure) noexcept{
+			T raw = expected.get_value();
+			const bool exchanged = value.compare_exchange_weak(raw, desired.get_value(), success, failure);
+			expected = number{raw};
+			return exchanged;
+		}
+
+		bool compare_exchange_weak(number& expected, number desired,
+				memory_order order = memory_order_seq_cst) noexcept{
+			T raw = expected.get_value();
+			const bool exchanged = value.compare_exchange_weak(raw, desired.get_value(), order);
+			expected = number{raw};
+			return exchanged;
+		}
+
+		bool compare_exchange_strong(number& expected, number desired,
+				memory_order success, memory_order failure) noexcept{
+			T raw = expected.get_value();
+			const bool exchanged = value.compare_exchange_strong(raw, desired.get_value(), success, failure);
+			expected = number{raw};
+			return exchanged;
+		}
+
+		bool compare_exchange_strong(number& expected, number desired,
+				memory_order order = memory_order_seq_cst) noexcept{
+			T raw = expected.get_value();
+			const bool exchanged = value.compare_exchange_strong(raw, desired.get_value(), order);
+			expected = number{raw};
+			return exchanged;
+		}
+
+		/**
+		 * @brief Replaces the value by function(value) in a loop of
+		 *        compare_exchange_weak, that calls function again whenever another
+		 *        thread changed the value in between.
+		 * @param order the order of the exchange; the value is loaded relaxed
+		 * @return the replaced value
+		 * @throws whatever function throws, in which case the value is unchanged
+		 */
+		template<typename Tfunction>
+		number fetch_update(Tfunction function, memory_order order = memory_order_seq_cst){
+			number expected = load(memory_order_relaxed);
+			while(!compare_exchange_weak(expected, function(expected), order, memory_order_relaxed)){}
+			return expected;
+		}
+
+		TYPE_BUILDER_TEMPLATE(Tother, (Tflags & type_builder::ENABLE_SPECIFIC_PLUS_MINUS) != 0,
+			std::is_same<Tother, number>::value)
+		number fetch_add(const Tother& arg, memory_order order = memory_order_seq_cst)
+				noexcept(native::value){
+			return fetch_add(arg, order, native{});
+		}
+
+		TYPE_BUILDER_TEMPLATE(Tother, (Tflags & type_builder::ENABLE_SPECIFIC_PLUS_MINUS) != 0,
+			std::is_same<Tother, number>::value)
+		number fetch_sub(const Tother& arg, memory_order order = memory_order_seq_cst)
+				noexcept(native::value){
+			return fetch_sub(arg, order, native{});
+		}
+
+		TYPE_BUILDER_TEMPLATE(Tother, (Tflags & type_builder::ENABLE_SPECIFIC_PLUS_MINUS) != 0,
+			std::is_same<Tother, number>::value)
+		number operator+=(const Tother& arg) noexcept(native::value){
+			return add(arg, native{});
+		}
+
+		TYPE_BUILDER_TEMPLATE(Tother, (Tflags & type_builder::ENABLE_SPECIFIC_PLUS_MINUS) != 0,
+			std::is_same<Tother, number>::value)
+		number operator-=(const Tother& arg) noexcept(native::value){
+			return subtract(arg, native{});
+		}
+
+		number operator++() noexcept(native::value){
+			static_assert((Tflags & type_builder::ENABLE_INC_DEC) != 0,
+					"increment not enabled for this number-type");
+			return increment(native{});
+		}
+
+		number operator++(int) noexcept(native::value){
+			static_assert((Tflags & type_builder::ENABLE_INC_DEC) != 0,
+					"increment not enabled for this number-type");
+			return post_increment(native{});
+		}
+
+		number operator--() noexcept(native::value){
+			static_assert((Tflags & type_builder::ENABLE_INC_DEC) != 0,
+					"increment not enabled for this number-type");
+			return decrement(native{});
+		}
+
+		number operator--(int) noexcept(native::value){
+			static_assert((Tflags & type_builder::ENABLE_INC_DEC) != 0,
+					"increment not enabled for this number-type");
+			return post_decrement(native{});
+		}
+};
+
+} // namespace std
+
+#endif
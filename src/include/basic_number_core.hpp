@@ -8,10 +8,269 @@
 #include "basic_number_flags.hpp"
 #include "policy_types.hpp"
 
+// constexpr-functions may only modify objects since C++14, so the members that do so
+// are only constexpr there:
+#if __cplusplus >= 201402L
+#	define TYPE_BUILDER_RELAXED_CONSTEXPR constexpr
+#else
+#	define TYPE_BUILDER_RELAXED_CONSTEXPR
+#endif
+
+// Without optimization every operator is a real call through several frames. The
+// opt-in TYPE_BUILDER_DEBUG_PERFORMANCE inlines the trivial ones even then and marks
+// them as artificial, so that debuggers step over them like over built-in operators:
+#if defined(TYPE_BUILDER_DEBUG_PERFORMANCE) && defined(__GNUC__)
+#	define TYPE_BUILDER_TRIVIAL inline __attribute__((always_inline, artificial))
+#else
+#	define TYPE_BUILDER_TRIVIAL inline
+#endif
+
+// Starts the declaration of an operator-template for the operand-type Tparam, that
+// only exists if the flags enable it and the condition on Tparam holds. The flags are
+// tested first and directly on Tflags, so that disabled operators are discarded before
+// anything about the operand-type is instantiated. Since C++20 both are requirements,
+// whose satisfaction the compiler caches per operand-type. Before, a template with the
+// same signature as another one has to be declared with TYPE_BUILDER_OVERLOAD_TEMPLATE,
+// which adds an unused parameter to tell them apart, and a third one with
+// TYPE_BUILDER_LAZY_TEMPLATE:
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
+#	define TYPE_BUILDER_TEMPLATE(Tparam, Tenabled, ...) \
+	template<typename Tparam> requires (Tenabled) && (__VA_ARGS__)
+#	define TYPE_BUILDER_OVERLOAD_TEMPLATE(Tparam, Tenabled, ...) \
+	TYPE_BUILDER_TEMPLATE(Tparam, Tenabled, __VA_ARGS__)
+#	define TYPE_BUILDER_LAZY_TEMPLATE(Tparam, Tenabled, ...) \
+	TYPE_BUILDER_TEMPLATE(Tparam, Tenabled, __VA_ARGS__)
+#else
+#	define TYPE_BUILDER_TEMPLATE(Tparam, Tenabled, ...) \
+	template<typename Tparam, \
+		typename = typename std::enable_if<(Tenabled), Tparam>::type, \
+		typename = typename std::enable_if<(__VA_ARGS__)>::type>
+#	define TYPE_BUILDER_OVERLOAD_TEMPLATE(Tparam, Tenabled, ...) \
+	template<typename Tparam, \
+		typename = typename std::enable_if<(Tenabled), Tparam>::type, \
+		typename = typename std::enable_if<(__VA_ARGS__)>::type, \
+		typename = void>
+#	define TYPE_BUILDER_LAZY_TEMPLATE(Tparam, Tenabled, ...) \
+	template<typename Tparam, \
+		typename = typename std::enable_if<(Tenabled), Tparam>::type, \
+		typename = typename std::enable_if<(__VA_ARGS__)>::type, \
+		typename = void, \
+		typename = void>
+#endif
+
 namespace type_builder{
 
+template<typename T>
+class divisor;
+
+// see safe_int_policies.hpp:
+struct throw_on_error;
+struct saturate_on_error;
+struct trap_on_error;
+
+namespace impl{
+
+// Deletes the assignments of immutable numbers, so that basic_number can default its
+// own and stays trivially copyable. It depends on T and Tid, so that a basic_number
+// of a basic_number doesn't contain two guards of the same type, which would have to
+// be at different addresses and would make it bigger than its value.
+template<typename T, class Tid, bool Tmutable>
+struct assignment_guard{};
+
+template<typename T, class Tid>
+struct assignment_guard<T, Tid, false>{
+	assignment_guard() = default;
+	assignment_guard(const assignment_guard&) = default;
+	assignment_guard(assignment_guard&&) = default;
+	assignment_guard& operator=(const assignment_guard&) = delete;
+	assignment_guard& operator=(assignment_guard&&) = delete;
+};
+
+// see basic_number_lazy.hpp:
+struct lazy_plus{};
+struct lazy_minus{};
+struct lazy_multiplies{};
+struct lazy_divides{};
+
+template<typename Top, typename Tlhs, typename Trhs>
+class lazy_expression;
+
+template<typename Toperand>
+struct lazy_operand;
+
+template<typename T>
+struct is_lazy_expression: std::false_type{};
+
+template<typename Top, typename Tlhs, typename Trhs>
+struct is_lazy_expression<lazy_expression<Top, Tlhs, Trhs>>: std::true_type{};
+
+// see divisor.hpp; numbers only divide by divisors of their own type:
+template<typename Targ, typename T>
+struct is_divisor: std::false_type{};
+
+template<typename T>
+struct is_divisor<divisor<T>, T>: std::true_type{};
+
+// Check whether T has the compound assignments, that the operators of expiring
+// numbers use to compute the result in their own value:
+template<typename T, typename = void>
+struct has_plus_assignment: std::false_type{};
+
+template<typename T>
+struct has_plus_assignment<T, decltype(void(std::declval<T&>() += std::declval<const T&>()))>:
+	std::true_type{};
+
+template<typename T, typename = void>
+struct has_minus_assignment: std::false_type{};
+
+template<typename T>
+struct has_minus_assignment<T, decltype(void(std::declval<T&>() -= std::declval<const T&>()))>:
+	std::true_type{};
+
+template<typename T, typename = void>
+struct has_multiplies_assignment: std::false_type{};
+
+template<typename T>
+struct has_multiplies_assignment<T, decltype(void(std::declval<T&>() *= std::declval<const T&>()))>:
+	std::true_type{};
+
+template<typename T, typename = void>
+struct has_divides_assignment: std::false_type{};
+
+template<typename T>
+struct has_divides_assignment<T, decltype(void(std::declval<T&>() /= std::declval<const T&>()))>:
+	std::true_type{};
+
+// The arithmetic of the operators of basic_number, that returns a Tresult. It just
+// applies the operators unless ENABLE_OVERFLOW_CHECK selects checked_arithmetic:
+template<typename Tresult>
+struct arithmetic{
+	template<typename Tlhs, typename Trhs>
+	static constexpr Tresult plus(const Tlhs& lhs, const Trhs& rhs)
+			noexcept(noexcept(static_cast<Tresult>(lhs + rhs))){
+		return static_cast<Tresult>(lhs + rhs);
+	}
+
+	template<typename Tlhs, typename Trhs>
+	static constexpr Tresult minus(const Tlhs& lhs, const Trhs& rhs)
+			noexcept(noexcept(static_cast<Tresult>(lhs - rhs))){
+		return static_cast<Tresult>(lhs - rhs);
+	}
+
+	template<typename Tlhs, typename Trhs>
+	static constexpr Tresult multiplies(const Tlhs& lhs, const Trhs& rhs)
+			noexcept(noexcept(static_cast<Tresult>(lhs * rhs))){
+		return static_cast<Tresult>(lhs * rhs);
+	}
+
+	template<typename Tlhs, typename Trhs>
+	static constexpr Tresult divides(const Tlhs& lhs, const Trhs& rhs)
+			noexcept(noexcept(static_cast<Tresult>(lhs / rhs))){
+		return static_cast<Tresult>(lhs / rhs);
+	}
+
+	template<typename Tlhs, typename Trhs>
+	static constexpr Tresult modulus(const Tlhs& lhs, const Trhs& rhs)
+			noexcept(noexcept(static_cast<Tresult>(lhs % rhs))){
+		return static_cast<Tresult>(lhs % rhs);
+	}
+
+	template<typename Targ>
+	static constexpr Tresult negate(const Targ& value) noexcept(noexcept(static_cast<Tresult>(-value))){
+		return static_cast<Tresult>(-value);
+	}
+
+	// the compound assignments keep those of Tresult, which may be cheaper:
+
+	template<typename Trhs>
+	static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult& plus_assign(Tresult& lhs, const Trhs& rhs)
+			noexcept(noexcept(lhs += rhs)){
+		return lhs += rhs;
+	}
+
+	template<typename Trhs>
+	static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult& minus_assign(Tresult& lhs, const Trhs& rhs)
+			noexcept(noexcept(lhs -= rhs)){
+		return lhs -= rhs;
+	}
+
+	template<typename Trhs>
+	static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult& multiplies_assign(Tresult& lhs, const Trhs& rhs)
+			noexcept(noexcept(lhs *= rhs)){
+		return lhs *= rhs;
+	}
+
+	template<typename Trhs>
+	static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult& divides_assign(Tresult& lhs, const Trhs& rhs)
+			noexcept(noexcept(lhs /= rhs)){
+		return lhs /= rhs;
+	}
+
+	template<typename Trhs>
+	static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult& modulus_assign(Tresult& lhs, const Trhs& rhs)
+			noexcept(noexcept(lhs %= rhs)){
+		return lhs %= rhs;
+	}
+
+	static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult& increment(Tresult& value) noexcept(noexcept(++value)){
+		return ++value;
+	}
+
+	static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult& decrement(Tresult& value) noexcept(noexcept(--value)){
+		return --value;
+	}
+
+	static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult post_increment(Tresult& value) noexcept(noexcept(value++)){
+		return value++;
+	}
+
+	static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult post_decrement(Tresult& value) noexcept(noexcept(value--)){
+		return value--;
+	}
+};
+
+// see basic_number_overflow.hpp, which has to be included for ENABLE_OVERFLOW_CHECK:
+template<typename Tresult, typename Tpolicy>
+struct checked_arithmetic;
+
+template<flag_t Tflags>
+struct overflow_policy{
+	typedef typename std::conditional<(Tflags & TRAP_ON_OVERFLOW_O_) != 0, trap_on_error,
+		typename std::conditional<(Tflags & SATURATE_ON_OVERFLOW_O_) != 0, saturate_on_error,
+			throw_on_error>::type>::type type;
+};
+
+template<typename T>
+struct is_checked_integer: std::integral_constant<bool,
+	std::is_integral<T>::value && !std::is_same<T, bool>::value>{};
+
+// Selects the arithmetic for a Tresult that is computed from a T and a Tother. The
+// flag is tested first, so that numbers without it don't instantiate anything more:
+template<bool Tchecked>
+struct arithmetic_of{
+	template<typename Tresult, typename T, typename Tother, flag_t Tflags>
+	using type = arithmetic<Tresult>;
+};
+
+template<>
+struct arithmetic_of<true>{
+	template<typename Tresult, typename T, typename Tother, flag_t Tflags>
+	using type = typename std::conditional<is_checked_integer<Tresult>::value
+			&& is_checked_integer<T>::value
+			&& (is_checked_integer<typename std::decay<Tother>::type>::value
+				|| is_divisor<typename std::decay<Tother>::type, Tresult>::value),
+		checked_arithmetic<Tresult, typename overflow_policy<Tflags>::type>,
+		arithmetic<Tresult>>::type;
+};
+
+}
+
 /**
  * @brief A template for a number-class.
+ *
+ * With an empty Tbase it has the size and the alignment of T and is trivially
+ * copyable if T is, so that arrays of it can be viewed as arrays of T; see
+ * as_underlying().
  */
 // note that the operators are not documented with doxygen
 // because they behave pretty much as you would expect anyway.
@@ -20,7 +279,8 @@ template<
 	class Tid,
 	flag_t Tflags = DEFAULT_SETTINGS,
 	template<typename, class> class Tbase = empty_base>
-class basic_number: protected Tbase<T, Tid> {
+class basic_number: protected Tbase<T, Tid>,
+		private impl::assignment_guard<T, Tid, (Tflags & DISABLE_MUTABILITY) == 0> {
 	//put the private stuff to the begining because we will need it in 
 	// signatures:
 	
@@ -29,6 +289,12 @@ class basic_number: protected Tbase<T, Tid> {
 	 */
 	T value;
 	
+	template<typename, typename, typename>
+	friend class impl::lazy_expression;
+	
+	template<typename>
+	friend struct impl::lazy_operand;
+	
 	/**
 	 * @brief Checks if a type is identical to *this.
 	 * @return true if it is, false otherwise.
@@ -81,6 +347,45 @@ class basic_number: protected Tbase<T, Tid> {
 		std::integral_constant<bool, flag_set(ENABLE_NATIVE_TYPING) ?
 			true : is_this<basic_number<Targ, Tid, Tflags, Tbase>>() > {};
 	
+	// expressions are equivalent to the numbers that they evaluate to:
+	template<typename Top, typename Tlhs, typename Trhs>
+	struct _is_equivalent_basic_number<impl::lazy_expression<Top, Tlhs, Trhs>&> :
+		std::is_same<typename impl::lazy_expression<Top, Tlhs, Trhs>::number_type,
+			basic_number> {};
+	
+	/**
+	 * @brief Checks whether *this may be multiplied with a Targ that is not
+	 *        equivalent to it.
+	 */
+	template<typename Targ>
+	static constexpr bool multiplication_permitted(){
+		return (Tflags & ENABLE_GENERAL_MULTIPLICATION) != 0
+			|| (std::is_floating_point<typename std::remove_reference<Targ>::type>{}
+				&& (Tflags & ENABLE_FLOAT_MULTIPLICATION_O_) != 0)
+			|| (std::is_integral<typename std::remove_reference<Targ>::type>{}
+				&& (Tflags & ENABLE_INTEGER_MULTIPLICATION) != 0)
+			|| ((Tflags & ENABLE_BASE_MULTIPLICATION_O_) != 0
+				&& std::is_floating_point<typename std::remove_reference<Targ>::type>{}
+				&& std::is_floating_point<T>{});
+	}
+	
+	/**
+	 * @brief Checks whether *this may be divided by a Targ that is not equivalent
+	 *        to it.
+	 */
+	template<typename Targ>
+	static constexpr bool division_permitted(){
+		return (Tflags & ENABLE_GENERAL_DIVISION) != 0
+			|| (std::is_floating_point<typename std::remove_reference<Targ>::type>{}
+				&& (Tflags & ENABLE_FLOAT_DIVISION_O_) != 0)
+			|| ((std::is_integral<typename std::remove_reference<Targ>::type>{}
+					|| impl::is_divisor<typename std::remove_reference<Targ>::type, T>{})
+				&& (Tflags & ENABLE_INTEGER_DIVISION) != 0)
+			|| ((Tflags & ENABLE_BASE_DIVISION_O_) != 0
+				&& std::is_floating_point<typename std::remove_reference<Targ>::type>{}
+				&& std::is_floating_point<T>{});
+	}
+	
 	/**
 	 * @brief Checks whether a type is semanticly equivalent to *this.
 	 * @param Targ the type that will be checked.
@@ -93,6 +398,55 @@ class basic_number: protected Tbase<T, Tid> {
 			>::type&>{};
 	}
 	
+	/**
+	 * @brief Checks whether *this or an expression of it may be added to or
+	 *        subtracted from a Targ lazily.
+	 */
+	template<typename Targ>
+	static constexpr bool lazy_plus_minus_permitted(){
+		return (Tflags & ENABLE_LAZY_EVALUATION) != 0
+			&& (Tflags & ENABLE_SPECIFIC_PLUS_MINUS) != 0
+			&& is_equivalent_basic_number<Targ>();
+	}
+	
+	/**
+	 * @brief Checks whether *this or an expression of it may be multiplied with a
+	 *        Targ lazily.
+	 */
+	template<typename Targ>
+	static constexpr bool lazy_multiplication_permitted(){
+		return (Tflags & ENABLE_LAZY_EVALUATION) != 0
+			&& (is_equivalent_basic_number<Targ>()
+				? (Tflags & ENABLE_SPECIFIC_MULTIPLICATION) != 0
+				: multiplication_permitted<Targ>());
+	}
+	
+	/**
+	 * @brief Checks whether *this or an expression of it may be divided by a Targ
+	 *        lazily.
+	 */
+	template<typename Targ>
+	static constexpr bool lazy_division_permitted(){
+		return (Tflags & ENABLE_LAZY_EVALUATION) != 0
+			&& (is_equivalent_basic_number<Targ>()
+				? (Tflags & ENABLE_SPECIFIC_DIVISION) != 0
+				: division_permitted<Targ>());
+	}
+	
+	static_assert((Tflags & ENABLE_OVERFLOW_CHECK) == 0 || (Tflags & ENABLE_LAZY_EVALUATION) == 0,
+			"the overflow-checks don't apply to lazy expressions");
+	
+	/**
+	 * @brief The arithmetic that computes a Tresult from the value and a Tother,
+	 *        which checks for overflows if ENABLE_OVERFLOW_CHECK is set and all of
+	 *        them are integers.
+	 * @note The operators of numbers with the flag are never noexcept, which keeps
+	 *       their exception-specifications as cheap for the compiler as before.
+	 */
+	template<typename Tresult, typename Tother = T>
+	using arithmetic = typename impl::arithmetic_of<(Tflags & ENABLE_OVERFLOW_CHECK) != 0>
+		::template type<Tresult, T, Tother, Tflags>;
+	
 	public:
 		
 		// constructors and methods that will be created anyway:
@@ -100,544 +454,609 @@ class basic_number: protected Tbase<T, Tid> {
 		// we have to provide them allways, in order to prevent the creation of defaults 
 		// if we do not want them:
 		
-		basic_number() : value(Tbase<T, Tid>::default_value()) {
+		TYPE_BUILDER_TRIVIAL constexpr basic_number()
+				noexcept(noexcept(T(Tbase<T, Tid>::default_value())))
+			: value(Tbase<T, Tid>::default_value()) {
 			static_assert(flag_set(ENABLE_DEFAULT_CONSTRUCTION),
 					"default constructor not enabled for this type");
 		}
 		
-		basic_number(const basic_number& rhs) = default;
+		constexpr basic_number(const basic_number& rhs) = default;
 		
-		basic_number(basic_number&& rhs) = default;
+		constexpr basic_number(basic_number&& rhs) = default;
 		
-		basic_number& operator=(const basic_number& rhs){
-			static_assert(flag_unset(DISABLE_MUTABILITY),
-					"invalid assignment to immutable type.");
-			value = rhs.value;
-			return *this;
-		}
+		// deleted for immutable types by impl::assignment_guard:
+		TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator=(const basic_number& rhs) = default;
 		
-		basic_number& operator=(basic_number&& rhs){
-			static_assert(flag_unset(DISABLE_MUTABILITY),
-					"invalid assignment to immutable type.");
-			value = std::move(rhs.value);
-			return *this;
-		}
+		TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator=(basic_number&& rhs) = default;
 		
 		~basic_number() = default;
 		
 		// custom constructors:
 		
 		// basic_number(basic_number)
-		template<
-			typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<std::is_same<Tother,basic_number>{}>::type
-		>
-		basic_number(const Tother& other): value(other.get_value()){}
+		TYPE_BUILDER_TEMPLATE(Tother, true,
+			is_equivalent_basic_number<Tother>()
+			&& std::is_same<Tother,basic_number>::value)
+		TYPE_BUILDER_TRIVIAL constexpr basic_number(const Tother& other)
+				noexcept(noexcept(T(other.get_value_ref())))
+			: value(other.get_value_ref()){}
+		
+		// the values are forwarded, so that expiring ones are moved instead of copied
+		// (static_cast instead of std::forward, which isn't constexpr in C++11):
 		
 		// basic_number(T)
 		template<
 			typename Tother,
-			typename = typename std::enable_if<std::is_same<Tother&, T&>{}>::type
+			typename = typename std::enable_if<
+				std::is_same<typename std::decay<Tother>::type, T>{}>::type
 		>
-		explicit basic_number(const Tother& value): value(value){}
+		TYPE_BUILDER_TRIVIAL constexpr explicit basic_number(Tother&& value)
+			noexcept(std::is_nothrow_constructible<T, Tother&&>::value)
+			: value(static_cast<Tother&&>(value)){}
 		
 		// basic_number(Tother)
-		template<
-			typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<!std::is_same<Tother&, T&>{}>::type,
-			typename = typename std::enable_if<flag_unset<Tother>(ENABLE_GENERAL_CONSTRUCTION)>::type
-		>
-		explicit basic_number(const Tother& value): value(value){}
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & ENABLE_GENERAL_CONSTRUCTION) == 0,
+			!is_equivalent_basic_number<Tother>()
+			&& !std::is_same<typename std::decay<Tother>::type, T>::value)
+		TYPE_BUILDER_TRIVIAL constexpr explicit basic_number(Tother&& value)
+			noexcept(std::is_nothrow_constructible<T, Tother&&>::value)
+			: value(static_cast<Tother&&>(value)){}
 		
 		// methods:
 		
 		// *this = basic_number
-		template<
-			typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<std::is_same<Tother,basic_number>{}>::type,
-			typename = typename std::enable_if<flag_unset<Tother>(DISABLE_MUTABILITY)>::type
-		>
-		basic_number& operator=(const Tother& other){
+		TYPE_BUILDER_TEMPLATE(Tother, (Tflags & DISABLE_MUTABILITY) == 0,
+			is_equivalent_basic_number<Tother>()
+			&& std::is_same<Tother,basic_number>::value)
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator=(const Tother& other)
+				noexcept(std::is_nothrow_copy_assignable<T>::value){
 			this->value = other.value;
 			return *this;
 		}
 		
 		// *this = Tother
-		template<
-			typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_LATE_ASSIGNEMENT)>::type,
-			typename = typename std::enable_if<
-					std::is_same<T&, Tother&>{}
-					|| flag_set<Tother>(ENABLE_GENERAL_CONSTRUCTION)
-				>::type,
-			typename = void
-		>
-		basic_number& operator=(const Tother& value){
-			this->value = value;
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & ENABLE_LATE_ASSIGNEMENT) != 0,
+			!is_equivalent_basic_number<Tother>()
+			&& (std::is_same<T, typename std::decay<Tother>::type>::value
+				|| (Tflags & ENABLE_GENERAL_CONSTRUCTION) != 0))
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator=(Tother&& value)
+				noexcept(std::is_nothrow_assignable<T&, Tother&&>::value){
+			this->value = static_cast<Tother&&>(value);
 			return *this;
 		}
 		
 		// comparision-methods:
 		
 		// *this == basic_number
-		template <typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_EQUALITY_CHECK)>::type
-		>
-		bool operator==(const Tother& other) const{
-			return value == other.get_value();
+		TYPE_BUILDER_TEMPLATE(Tother, (Tflags & ENABLE_SPECIFIC_EQUALITY_CHECK) != 0,
+			is_equivalent_basic_number<Tother>() && !impl::is_lazy_expression<Tother>::value)
+		TYPE_BUILDER_TRIVIAL constexpr bool operator==(const Tother& other) const
+				noexcept(noexcept(value == other.get_value_ref())){
+			return value == other.get_value_ref();
 		}
 		
 		// *this == Tother
-		template <typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_EQUALITY_CHECK_O_)>::type,
-			typename = void
-		>
-		bool operator==(const Tother& other) const{
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & ENABLE_EQUALITY_CHECK_O_) != 0,
+			!is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr bool operator==(const Tother& other) const
+				noexcept(noexcept(value == other)){
 			return value == other;
 		}
 		
 		// *this != basic_number
-		template <typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_EQUALITY_CHECK)>::type
-		>
-		bool operator!=(const Tother& other) const{
-			return value != other.get_value();
+		TYPE_BUILDER_TEMPLATE(Tother, (Tflags & ENABLE_SPECIFIC_EQUALITY_CHECK) != 0,
+			is_equivalent_basic_number<Tother>() && !impl::is_lazy_expression<Tother>::value)
+		TYPE_BUILDER_TRIVIAL constexpr bool operator!=(const Tother& other) const
+				noexcept(noexcept(value != other.get_value_ref())){
+			return value != other.get_value_ref();
 		}
 		
 		// *this != Tother
-		template <typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_EQUALITY_CHECK_O_)>::type,
-			typename = void
-		>
-		bool operator!=(const Tother& other) const{
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & ENABLE_EQUALITY_CHECK_O_) != 0,
+			!is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr bool operator!=(const Tother& other) const
+				noexcept(noexcept(value != other)){
 			return value != other;
 		}
 		
 		// *this < basic_number
-		template <typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_ORDERING_O_)>::type
-		>
-		bool operator<(const Tother& other) const{
-			return value < other.get_value();
+		TYPE_BUILDER_TEMPLATE(Tother, (Tflags & ENABLE_SPECIFIC_ORDERING_O_) != 0,
+			is_equivalent_basic_number<Tother>() && !impl::is_lazy_expression<Tother>::value)
+		TYPE_BUILDER_TRIVIAL constexpr bool operator<(const Tother& other) const
+				noexcept(noexcept(value < other.get_value_ref())){
+			return value < other.get_value_ref();
 		}
 		
 		// *this < Tother
-		template <typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_ORDERING_O_)>::type,
-			typename = void
-		>
-		bool operator<(const Tother& other) const{
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & ENABLE_ORDERING_O_) != 0,
+			!is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr bool operator<(const Tother& other) const
+				noexcept(noexcept(value < other)){
 			return value < other;
 		}
 		
 		// *this <= basic_number
-		template <typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_ORDERING_O_)>::type
-		>
-		bool operator<=(const Tother& other) const{
-			return value <= other.get_value();
+		TYPE_BUILDER_TEMPLATE(Tother, (Tflags & ENABLE_SPECIFIC_ORDERING_O_) != 0,
+			is_equivalent_basic_number<Tother>() && !impl::is_lazy_expression<Tother>::value)
+		TYPE_BUILDER_TRIVIAL constexpr bool operator<=(const Tother& other) const
+				noexcept(noexcept(value <= other.get_value_ref())){
+			return value <= other.get_value_ref();
 		}
 		
 		// *this <= Tother
-		template <typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_ORDERING_O_)>::type,
-			typename = void
-		>
-		bool operator<=(const Tother& other) const{
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & ENABLE_ORDERING_O_) != 0,
+			!is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr bool operator<=(const Tother& other) const
+				noexcept(noexcept(value <= other)){
 			return value <= other;
 		}
 		
 		// *this > basic_number
-		template <typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_ORDERING_O_)>::type
-		>
-		bool operator>(const Tother& other) const{
-			return value > other.get_value();
+		TYPE_BUILDER_TEMPLATE(Tother, (Tflags & ENABLE_SPECIFIC_ORDERING_O_) != 0,
+			is_equivalent_basic_number<Tother>() && !impl::is_lazy_expression<Tother>::value)
+		TYPE_BUILDER_TRIVIAL constexpr bool operator>(const Tother& other) const
+				noexcept(noexcept(value > other.get_value_ref())){
+			return value > other.get_value_ref();
 		}
 		
 		// *this > Tother
-		template <typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_ORDERING_O_)>::type,
-			typename = void
-		>
-		bool operator>(const Tother& other) const{
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & ENABLE_ORDERING_O_) != 0,
+			!is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr bool operator>(const Tother& other) const
+				noexcept(noexcept(value > other)){
 			return value > other;
 		}
 		
 		
 		// *this >= basic_number
-		template <typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_ORDERING_O_)>::type
-		>
-		bool operator>=(const Tother& other) const{
-			return value >= other.get_value();
+		TYPE_BUILDER_TEMPLATE(Tother, (Tflags & ENABLE_SPECIFIC_ORDERING_O_) != 0,
+			is_equivalent_basic_number<Tother>() && !impl::is_lazy_expression<Tother>::value)
+		TYPE_BUILDER_TRIVIAL constexpr bool operator>=(const Tother& other) const
+				noexcept(noexcept(value >= other.get_value_ref())){
+			return value >= other.get_value_ref();
 		}
 		
 		// *this >= Tother
-		template <typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_ORDERING_O_)>::type,
-			typename = void
-		>
-		bool operator>=(const Tother& other) const{
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & ENABLE_ORDERING_O_) != 0,
+			!is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr bool operator>=(const Tother& other) const
+				noexcept(noexcept(value >= other)){
 			return value >= other;
 		}
 		
-		basic_number& operator++(){
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator++()
+				noexcept(noexcept(++value) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
 			static_assert(flag_unset(DISABLE_MUTABILITY),
 					"You cannot change the value of an instance "
 					"of an immutable type");
 			static_assert(flag_set(ENABLE_INC_DEC),
 					"increment not enabled for this number-type");
-			++value;
+			arithmetic<T>::increment(value);
 			return *this;
 		}
 		
-		basic_number operator++(int){
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number operator++(int)
+				noexcept(noexcept(value++) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
 			static_assert(flag_unset(DISABLE_MUTABILITY),
 					"You cannot change the value of an instance "
 					"of an immutable type");
 			static_assert(flag_set(ENABLE_INC_DEC),
 					"increment not enabled for this number-type");
-			return basic_number(value++);
+			return basic_number(arithmetic<T>::post_increment(value));
 		}
 		
-		basic_number& operator--(){
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator--()
+				noexcept(noexcept(--value) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
 			static_assert(flag_unset(DISABLE_MUTABILITY),
 					"You cannot change the value of an instance "
 					"of an immutable type");
 			static_assert(flag_set(ENABLE_INC_DEC),
 					"increment not enabled for this number-type");
-			--value;
+			arithmetic<T>::decrement(value);
 			return *this;
 		}
 		
-		basic_number operator--(int){
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number operator--(int)
+				noexcept(noexcept(value--) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
 			static_assert(flag_unset(DISABLE_MUTABILITY),
 					"You cannot change the value of an instance "
 					"of an immutable type");
 			static_assert(flag_set(ENABLE_INC_DEC),
 					"increment not enabled for this number-type");
-			return basic_number(value--);
+			return basic_number(arithmetic<T>::post_decrement(value));
 		}
 		
 		// unary -
-		basic_number operator-(){
+		TYPE_BUILDER_TRIVIAL constexpr basic_number operator-() const
+				noexcept(noexcept(-value) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
 			static_assert(flag_set(ENABLE_SPECIFIC_PLUS_MINUS), 
 					"unary minus must be enabled by ENABLE_SPECIFIC_PLUS_MINUS");
-			return basic_number{ -value };
+			return basic_number{ arithmetic<T>::negate(value) };
 		}
 		
 		
 		// *this + basic_number
-		template<
-			typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_PLUS_MINUS)>::type
-		>
-		auto operator+(const Tother& other) const ->
-		typename return_type<basic_number<decltype(value + other.get_value()), Tid, Tflags,Tbase>>::type
+		TYPE_BUILDER_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) == 0 && (Tflags & ENABLE_SPECIFIC_PLUS_MINUS) != 0,
+			is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr auto operator+(const Tother& other) const &
+				noexcept(noexcept(value + other.get_value_ref()) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0) ->
+		typename return_type<basic_number<decltype(value + other.get_value_ref()), Tid, Tflags,Tbase>>::type
 		{
-			using return_type_base = typename return_type<decltype(value + other.get_value()), T>::type;
+			using return_type_base = typename return_type<decltype(value + other.get_value_ref()), T>::type;
 			return basic_number<return_type_base, Tid, Tflags, Tbase>{
-					static_cast<return_type_base>(value + other.get_value())
+					arithmetic<return_type_base, decltype(other.get_value_ref())>::plus(value, other.get_value_ref())
 				};
 		}
 		
+		// expiring basic_number + basic_number, in the value of the former:
+		TYPE_BUILDER_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) == 0 && (Tflags & ENABLE_NATIVE_TYPING) == 0
+				&& (Tflags & ENABLE_SPECIFIC_PLUS_MINUS) != 0 && !std::is_trivially_copyable<T>::value,
+			std::is_same<Tother, basic_number>::value && impl::has_plus_assignment<T>::value)
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number operator+(const Tother& other) &&
+				noexcept(noexcept(std::declval<T&>() += other.value)
+					&& std::is_nothrow_move_constructible<T>::value){
+			value += other.value;
+			return static_cast<basic_number&&>(*this);
+		}
+		
 		// *this + Tother
-		template<
-			typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_GENERAL_PLUS_MINUS)>::type,
-			typename = void
-		>
-		auto operator+(const Tother& other) const ->
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & ENABLE_GENERAL_PLUS_MINUS) != 0,
+			!is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr auto operator+(const Tother& other) const &
+				noexcept(noexcept(value + other) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0) ->
 			typename return_type<basic_number<decltype(value + other), Tid, Tflags, Tbase>>::type
 		{
 			using return_type_base = typename return_type<decltype(value + other), T>::type;
 			return basic_number<return_type_base, Tid, Tflags, Tbase>{
-					static_cast<return_type_base>(value + other)
+					arithmetic<return_type_base, Tother>::plus(value, other)
 			};
 		}
 		
 		// *this += basic_number
-		template<
-			typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_unset<Tother>(DISABLE_MUTABILITY)>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_PLUS_MINUS)>::type
-		>
-		basic_number& operator+=(const Tother& other){
-			value += other.get_value();
+		TYPE_BUILDER_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) == 0
+				&& (Tflags & DISABLE_MUTABILITY) == 0 && (Tflags & ENABLE_SPECIFIC_PLUS_MINUS) != 0,
+			is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator+=(const Tother& other)
+				noexcept(noexcept(value += other.get_value_ref()) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
+			arithmetic<T, decltype(other.get_value_ref())>::plus_assign(value, other.get_value_ref());
 			return *this;
 		}
 		
 		// *this += Tother
-		template<
-			typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_unset<Tother>(DISABLE_MUTABILITY)>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_GENERAL_PLUS_MINUS)>::type,
-			typename = void
-		>
-		basic_number& operator+=(const Tother& other){
-			value += other;
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother,
+			(Tflags & DISABLE_MUTABILITY) == 0 && (Tflags & ENABLE_GENERAL_PLUS_MINUS) != 0,
+			!is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator+=(const Tother& other)
+				noexcept(noexcept(value += other) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
+			arithmetic<T, Tother>::plus_assign(value, other);
 			return *this;
 		}
 		
 		// *this - basic_number
-		template<
-			typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_PLUS_MINUS)>::type
-		>
-		auto operator-(const Tother& other) const ->
-		typename return_type<basic_number<decltype(value - other.get_value()), Tid, Tflags,Tbase>>::type
+		TYPE_BUILDER_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) == 0 && (Tflags & ENABLE_SPECIFIC_PLUS_MINUS) != 0,
+			is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr auto operator-(const Tother& other) const &
+				noexcept(noexcept(value - other.get_value_ref()) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0) ->
+		typename return_type<basic_number<decltype(value - other.get_value_ref()), Tid, Tflags,Tbase>>::type
 		{
-			using return_type_base = typename return_type<decltype(value - other.get_value()), T>::type;
+			using return_type_base = typename return_type<decltype(value - other.get_value_ref()), T>::type;
 			return basic_number<return_type_base, Tid, Tflags, Tbase>{
-					static_cast<return_type_base>(value - other.get_value())
+					arithmetic<return_type_base, decltype(other.get_value_ref())>::minus(value, other.get_value_ref())
 				};
 		}
 		
+		// expiring basic_number - basic_number, in the value of the former:
+		TYPE_BUILDER_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) == 0 && (Tflags & ENABLE_NATIVE_TYPING) == 0
+				&& (Tflags & ENABLE_SPECIFIC_PLUS_MINUS) != 0 && !std::is_trivially_copyable<T>::value,
+			std::is_same<Tother, basic_number>::value && impl::has_minus_assignment<T>::value)
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number operator-(const Tother& other) &&
+				noexcept(noexcept(std::declval<T&>() -= other.value)
+					&& std::is_nothrow_move_constructible<T>::value){
+			value -= other.value;
+			return static_cast<basic_number&&>(*this);
+		}
+		
 		// *this - Tother
-		template<
-			typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_GENERAL_PLUS_MINUS)>::type,
-			typename = void
-		>
-		auto operator-(const Tother& other) const ->
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & ENABLE_GENERAL_PLUS_MINUS) != 0,
+			!is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr auto operator-(const Tother& other) const &
+				noexcept(noexcept(value - other) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0) ->
 			typename return_type<basic_number<decltype(value - other), Tid, Tflags, Tbase>>::type
 		{
 			using return_type_base = typename return_type<decltype(value - other), T>::type;
 			return basic_number<return_type_base, Tid, Tflags, Tbase>{
-					static_cast<return_type_base>(value - other)
+					arithmetic<return_type_base, Tother>::minus(value, other)
 				};
 		}
 		
 		// *this -= basic_number
-		template<
-			typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_unset<Tother>(DISABLE_MUTABILITY)>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_PLUS_MINUS)>::type
-		>
-		basic_number& operator-=(const Tother& other){
-			value -= other.get_value();
+		TYPE_BUILDER_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) == 0
+				&& (Tflags & DISABLE_MUTABILITY) == 0 && (Tflags & ENABLE_SPECIFIC_PLUS_MINUS) != 0,
+			is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator-=(const Tother& other)
+				noexcept(noexcept(value -= other.get_value_ref()) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
+			arithmetic<T, decltype(other.get_value_ref())>::minus_assign(value, other.get_value_ref());
 			return *this;
 		}
 		
 		// *this -= Tother
-		template<
-			typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_unset<Tother>(DISABLE_MUTABILITY)>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_GENERAL_PLUS_MINUS)>::type,
-			typename = void
-		>
-		basic_number& operator-=(const Tother& other){
-			value -= other;
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother,
+			(Tflags & DISABLE_MUTABILITY) == 0 && (Tflags & ENABLE_GENERAL_PLUS_MINUS) != 0,
+			!is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator-=(const Tother& other)
+				noexcept(noexcept(value -= other) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
+			arithmetic<T, Tother>::minus_assign(value, other);
 			return *this;
 		}
 		
 		// *this * basic_number
-		template<typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_MULTIPLICATION)>::type
-		>
-		auto operator*(const Tother& other) const ->
-		typename return_type<basic_number<decltype(value * other.get_value()), Tid, Tflags, Tbase>>::type
+		TYPE_BUILDER_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) == 0 && (Tflags & ENABLE_SPECIFIC_MULTIPLICATION) != 0,
+			is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr auto operator*(const Tother& other) const &
+				noexcept(noexcept(value * other.get_value_ref()) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0) ->
+		typename return_type<basic_number<decltype(value * other.get_value_ref()), Tid, Tflags, Tbase>>::type
 		{
-			using return_type_base = typename return_type<decltype(value * other.get_value()), T>::type;
+			using return_type_base = typename return_type<decltype(value * other.get_value_ref()), T>::type;
 			return basic_number<return_type_base, Tid, Tflags, Tbase>{
-					static_cast<return_type_base>(value * other.get_value())
+					arithmetic<return_type_base, decltype(other.get_value_ref())>::multiplies(value, other.get_value_ref())
 				};
 		}
 		
+		// expiring basic_number * basic_number, in the value of the former:
+		TYPE_BUILDER_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) == 0 && (Tflags & ENABLE_NATIVE_TYPING) == 0
+				&& (Tflags & ENABLE_SPECIFIC_MULTIPLICATION) != 0 && !std::is_trivially_copyable<T>::value,
+			std::is_same<Tother, basic_number>::value && impl::has_multiplies_assignment<T>::value)
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number operator*(const Tother& other) &&
+				noexcept(noexcept(std::declval<T&>() *= other.value)
+					&& std::is_nothrow_move_constructible<T>::value){
+			value *= other.value;
+			return static_cast<basic_number&&>(*this);
+		}
+		
 		// *this * Tother
-		template<typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<
-				flag_set<Tother>(ENABLE_GENERAL_MULTIPLICATION)
-				|| (std::is_floating_point<typename std::remove_reference<Tother>::type>{} 
-					&& flag_set<Tother>(ENABLE_FLOAT_MULTIPLICATION_O_))
-				|| (std::is_integral<typename std::remove_reference<Tother>::type>{} 
-					&& flag_set<Tother>(ENABLE_INTEGER_MULTIPLICATION))
-				|| (flag_set<Tother>(ENABLE_BASE_MULTIPLICATION_O_)
-					&& std::is_floating_point<typename std::remove_reference<Tother>::type>{}
-					&& std::is_floating_point<T>{})
-			>::type,
-			typename = void
-		>
-		auto operator*(const Tother& other) const ->
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & ENABLE_LAZY_EVALUATION) == 0,
+			!is_equivalent_basic_number<Tother>()
+			&& multiplication_permitted<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr auto operator*(const Tother& other) const &
+				noexcept(noexcept(value * other) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0) ->
 		typename return_type<basic_number<decltype(value * other), Tid, Tflags, Tbase>>::type
 		{
 			using return_type_base = typename return_type<decltype(value * other), T>::type;
 			return basic_number<return_type_base, Tid, Tflags, Tbase>{
-					static_cast<return_type_base>(value * other)
+					arithmetic<return_type_base, Tother>::multiplies(value, other)
 				};
 		}
 		
 		// *this *= basic_number
-		template<
-			typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_unset<Tother>(DISABLE_MUTABILITY)>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_MULTIPLICATION)>::type
-		>
-		basic_number& operator*=(const Tother& other){
-			value *= other.get_value();
+		TYPE_BUILDER_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) == 0
+				&& (Tflags & DISABLE_MUTABILITY) == 0 && (Tflags & ENABLE_SPECIFIC_MULTIPLICATION) != 0,
+			is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator*=(const Tother& other)
+				noexcept(noexcept(value *= other.get_value_ref()) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
+			arithmetic<T, decltype(other.get_value_ref())>::multiplies_assign(value, other.get_value_ref());
 			return *this;
 		}
 		
 		// *this *= Tother
-		template<
-			typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_unset<Tother>(DISABLE_MUTABILITY)>::type,
-			typename = typename std::enable_if<
-				flag_set<Tother>(ENABLE_GENERAL_MULTIPLICATION)
-				|| (std::is_floating_point<typename std::remove_reference<Tother>::type>{} 
-					&& flag_set<Tother>(ENABLE_FLOAT_MULTIPLICATION_O_))
-				|| (std::is_integral<typename std::remove_reference<Tother>::type>{} 
-					&& flag_set<Tother>(ENABLE_INTEGER_MULTIPLICATION))
-				|| (flag_set<Tother>(ENABLE_BASE_MULTIPLICATION_O_)
-					&& std::is_floating_point<typename std::remove_reference<Tother>::type>{}
-					&& std::is_floating_point<T>{})
-			>::type,
-			typename = void
-		>
-		basic_number& operator*=(const Tother& other){
-			value *= other;
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & DISABLE_MUTABILITY) == 0,
+			!is_equivalent_basic_number<Tother>()
+			&& multiplication_permitted<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator*=(const Tother& other)
+				noexcept(noexcept(value *= other) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
+			arithmetic<T, Tother>::multiplies_assign(value, other);
 			return *this;
 		}
 		
 		
 		// *this / basic_number
-		template<typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_DIVISION)>::type
-		>
-		auto operator/(const Tother& other) const ->
-		typename return_type<basic_number<decltype(value / other.get_value()), Tid, Tflags, Tbase>>::type
+		TYPE_BUILDER_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) == 0 && (Tflags & ENABLE_SPECIFIC_DIVISION) != 0,
+			is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr auto operator/(const Tother& other) const &
+				noexcept(noexcept(value / other.get_value_ref()) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0) ->
+		typename return_type<basic_number<decltype(value / other.get_value_ref()), Tid, Tflags, Tbase>>::type
 		{
-			using return_type_base = typename return_type<decltype(value / other.get_value()), T>::type;
+			using return_type_base = typename return_type<decltype(value / other.get_value_ref()), T>::type;
 			return basic_number<return_type_base, Tid, Tflags, Tbase>{
-					static_cast<return_type_base>(value / other.get_value())
+					arithmetic<return_type_base, decltype(other.get_value_ref())>::divides(value, other.get_value_ref())
 				};
 		}
 		
+		// expiring basic_number / basic_number, in the value of the former:
+		TYPE_BUILDER_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) == 0 && (Tflags & ENABLE_NATIVE_TYPING) == 0
+				&& (Tflags & ENABLE_SPECIFIC_DIVISION) != 0 && !std::is_trivially_copyable<T>::value,
+			std::is_same<Tother, basic_number>::value && impl::has_divides_assignment<T>::value)
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number operator/(const Tother& other) &&
+				noexcept(noexcept(std::declval<T&>() /= other.value)
+					&& std::is_nothrow_move_constructible<T>::value){
+			value /= other.value;
+			return static_cast<basic_number&&>(*this);
+		}
+		
 		// *this / Tother
-		template<typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<
-				flag_set<Tother>(ENABLE_GENERAL_DIVISION)
-				|| (std::is_floating_point<typename std::remove_reference<Tother>::type>{} 
-					&& flag_set<Tother>(ENABLE_FLOAT_DIVISION_O_))
-				|| (std::is_integral<typename std::remove_reference<Tother>::type>{} 
-					&& flag_set<Tother>(ENABLE_INTEGER_DIVISION))
-				|| (flag_set<Tother>(ENABLE_BASE_DIVISION_O_)
-					&& std::is_floating_point<typename std::remove_reference<Tother>::type>{}
-					&& std::is_floating_point<T>{})
-			>::type,
-			typename = void
-		>
-		auto operator/(const Tother& other) const ->
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & ENABLE_LAZY_EVALUATION) == 0,
+			!is_equivalent_basic_number<Tother>()
+			&& division_permitted<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr auto operator/(const Tother& other) const &
+				noexcept(noexcept(value / other) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0) ->
 		typename return_type<basic_number<decltype(value / other), Tid, Tflags, Tbase>>::type
 		{
 			using return_type_base = typename return_type<decltype(value / other), T>::type;
 			return basic_number<return_type_base, Tid, Tflags, Tbase>{
-					static_cast<return_type_base>(value / other)
+					arithmetic<return_type_base, Tother>::divides(value, other)
 				};
 		}
 		
 		// *this /= basic_number
-		template<typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_unset<Tother>(DISABLE_MUTABILITY)>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_DIVISION)>::type
-		>
-		basic_number& operator/=(const Tother& other){
-			value /= other.get_value();
+		TYPE_BUILDER_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) == 0
+				&& (Tflags & DISABLE_MUTABILITY) == 0 && (Tflags & ENABLE_SPECIFIC_DIVISION) != 0,
+			is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator/=(const Tother& other)
+				noexcept(noexcept(value /= other.get_value_ref()) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
+			arithmetic<T, decltype(other.get_value_ref())>::divides_assign(value, other.get_value_ref());
 			return *this;
 		}
 		
 		// *this /= Tother
-		template<typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_unset<Tother>(DISABLE_MUTABILITY)>::type,
-			typename = typename std::enable_if<
-				flag_set<Tother>(ENABLE_GENERAL_DIVISION)
-				|| (std::is_floating_point<typename std::remove_reference<Tother>::type>{} 
-					&& flag_set<Tother>(ENABLE_FLOAT_DIVISION_O_))
-				|| (std::is_integral<typename std::remove_reference<Tother>::type>{} 
-					&& flag_set<Tother>(ENABLE_INTEGER_DIVISION))
-				|| (flag_set<Tother>(ENABLE_BASE_DIVISION_O_)
-					&& std::is_floating_point<typename std::remove_reference<Tother>::type>{}
-					&& std::is_floating_point<T>{})
-			>::type,
-			typename = void
-		>
-		basic_number& operator/=(const Tother& other){
-			value /= other;
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & DISABLE_MUTABILITY) == 0,
+			!is_equivalent_basic_number<Tother>()
+			&& division_permitted<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator/=(const Tother& other)
+				noexcept(noexcept(value /= other) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
+			arithmetic<T, Tother>::divides_assign(value, other);
 			return *this;
 		}
 		
 		// *this % basic_number
-		template<typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_MODULO)>::type
-		>
-		basic_number operator%(const Tother& other) const{
-			return basic_number(value % other.get_value());
+		TYPE_BUILDER_TEMPLATE(Tother, (Tflags & ENABLE_SPECIFIC_MODULO) != 0,
+			is_equivalent_basic_number<Tother>() && !impl::is_lazy_expression<Tother>::value)
+		TYPE_BUILDER_TRIVIAL constexpr basic_number operator%(const Tother& other) const
+				noexcept(noexcept(value % other.get_value_ref()) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
+			return basic_number(arithmetic<T, decltype(other.get_value_ref())>
+				::modulus(value, other.get_value_ref()));
 		}
 		
 		// *this % Tother
-		template<typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_MODULO_O_)>::type,
-			typename = void
-		>
-		basic_number operator%(const Tother& other) const{
-			return basic_number(value % other);
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother, (Tflags & ENABLE_MODULO_O_) != 0,
+			!is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr basic_number operator%(const Tother& other) const
+				noexcept(noexcept(value % other) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
+			return basic_number(arithmetic<T, Tother>::modulus(value, other));
 		}
 		
 		// *this %= basic_number
-		template<typename Tother,
-			typename = typename std::enable_if<is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_unset<Tother>(DISABLE_MUTABILITY)>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_SPECIFIC_MODULO)>::type
-		>
-		basic_number& operator%=(const Tother& other){
-			value %= other.get_value();
+		TYPE_BUILDER_TEMPLATE(Tother,
+			(Tflags & DISABLE_MUTABILITY) == 0 && (Tflags & ENABLE_SPECIFIC_MODULO) != 0,
+			is_equivalent_basic_number<Tother>() && !impl::is_lazy_expression<Tother>::value)
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator%=(const Tother& other)
+				noexcept(noexcept(value %= other.get_value_ref()) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
+			arithmetic<T, decltype(other.get_value_ref())>::modulus_assign(value, other.get_value_ref());
 			return *this;
 		}
 		
 		// *this %= Tother
-		template<typename Tother,
-			typename = typename std::enable_if<!is_equivalent_basic_number<Tother>()>::type,
-			typename = typename std::enable_if<flag_unset<Tother>(DISABLE_MUTABILITY)>::type,
-			typename = typename std::enable_if<flag_set<Tother>(ENABLE_MODULO_O_)>::type,
-			typename = void
-		>
-		basic_number& operator%=(const Tother& other){
-			value %= other;
+		TYPE_BUILDER_OVERLOAD_TEMPLATE(Tother,
+			(Tflags & DISABLE_MUTABILITY) == 0 && (Tflags & ENABLE_MODULO_O_) != 0,
+			!is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator%=(const Tother& other)
+				noexcept(noexcept(value %= other) && (Tflags & ENABLE_OVERFLOW_CHECK) == 0){
+			arithmetic<T, Tother>::modulus_assign(value, other);
+			return *this;
+		}
+		
+		// lazy evaluation, see basic_number_lazy.hpp:
+		
+		// basic_number(expression)
+		TYPE_BUILDER_LAZY_TEMPLATE(Tother, (Tflags & ENABLE_LAZY_EVALUATION) != 0,
+			impl::is_lazy_expression<Tother>::value
+			&& is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number(const Tother& expression)
+			: value(expression.evaluate()){}
+		
+		// *this = expression
+		TYPE_BUILDER_LAZY_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) != 0 && (Tflags & DISABLE_MUTABILITY) == 0,
+			impl::is_lazy_expression<Tother>::value
+			&& is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator=(const Tother& expression){
+			if(expression.refers_to(&value)){
+				value = expression.evaluate();
+			}
+			else{
+				expression.assign_to(value);
+			}
+			return *this;
+		}
+		
+		// *this + basic_number or expression
+		TYPE_BUILDER_LAZY_TEMPLATE(Tother, (Tflags & ENABLE_LAZY_EVALUATION) != 0,
+			lazy_plus_minus_permitted<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr impl::lazy_expression<impl::lazy_plus, basic_number, Tother>
+		operator+(const Tother& other) const &{
+			return {*this, other};
+		}
+		
+		// *this - basic_number or expression
+		TYPE_BUILDER_LAZY_TEMPLATE(Tother, (Tflags & ENABLE_LAZY_EVALUATION) != 0,
+			lazy_plus_minus_permitted<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr impl::lazy_expression<impl::lazy_minus, basic_number, Tother>
+		operator-(const Tother& other) const &{
+			return {*this, other};
+		}
+		
+		// *this * basic_number, expression or Tother
+		TYPE_BUILDER_LAZY_TEMPLATE(Tother, (Tflags & ENABLE_LAZY_EVALUATION) != 0,
+			lazy_multiplication_permitted<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr impl::lazy_expression<impl::lazy_multiplies, basic_number, Tother>
+		operator*(const Tother& other) const &{
+			return {*this, other};
+		}
+		
+		// *this / basic_number, expression or Tother
+		TYPE_BUILDER_LAZY_TEMPLATE(Tother, (Tflags & ENABLE_LAZY_EVALUATION) != 0,
+			lazy_division_permitted<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr impl::lazy_expression<impl::lazy_divides, basic_number, Tother>
+		operator/(const Tother& other) const &{
+			return {*this, other};
+		}
+		
+		// *this += basic_number or expression
+		TYPE_BUILDER_LAZY_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) != 0 && (Tflags & DISABLE_MUTABILITY) == 0,
+			lazy_plus_minus_permitted<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator+=(const Tother& other){
+			if(impl::lazy_operand<Tother>::refers_to(other, &value)){
+				value += impl::lazy_operand<Tother>::evaluate(other);
+			}
+			else{
+				impl::lazy_operand<Tother>::add_to(value, other);
+			}
+			return *this;
+		}
+		
+		// *this -= basic_number or expression
+		TYPE_BUILDER_LAZY_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) != 0 && (Tflags & DISABLE_MUTABILITY) == 0,
+			lazy_plus_minus_permitted<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator-=(const Tother& other){
+			if(impl::lazy_operand<Tother>::refers_to(other, &value)){
+				value -= impl::lazy_operand<Tother>::evaluate(other);
+			}
+			else{
+				impl::lazy_operand<Tother>::subtract_from(value, other);
+			}
+			return *this;
+		}
+		
+		// *this *= basic_number or expression
+		TYPE_BUILDER_LAZY_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) != 0 && (Tflags & DISABLE_MUTABILITY) == 0
+				&& (Tflags & ENABLE_SPECIFIC_MULTIPLICATION) != 0,
+			is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator*=(const Tother& other){
+			impl::lazy_operand<Tother>::multiply(value, other);
+			return *this;
+		}
+		
+		// *this /= basic_number or expression
+		TYPE_BUILDER_LAZY_TEMPLATE(Tother,
+			(Tflags & ENABLE_LAZY_EVALUATION) != 0 && (Tflags & DISABLE_MUTABILITY) == 0
+				&& (Tflags & ENABLE_SPECIFIC_DIVISION) != 0,
+			is_equivalent_basic_number<Tother>())
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR basic_number& operator/=(const Tother& other){
+			impl::lazy_operand<Tother>::divide(value, other);
 			return *this;
 		}
 		
@@ -647,17 +1066,42 @@ class basic_number: protected Tbase<T, Tid> {
 		 * @brief Provides reading access to the underlying value.
 		 * @return the value of the underlying variable.
 		 */
-		T get_value() const{ 
+		TYPE_BUILDER_TRIVIAL constexpr T get_value() const &
+				noexcept(std::is_nothrow_copy_constructible<T>::value){
 			return value; 
 		}
 		
+		/**
+		 * @brief Moves the underlying value out of an expiring number.
+		 * @note Only for T that are not trivially copyable, which are copied anyway,
+		 *       so that the overload above stays usable in constant expressions of
+		 *       C++11.
+		 */
+		template<
+			typename Tvalue = T,
+			typename = typename std::enable_if<!std::is_trivially_copyable<Tvalue>::value>::type
+		>
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR T get_value() &&
+				noexcept(std::is_nothrow_move_constructible<T>::value){
+			return static_cast<T&&>(value);
+		}
+		
+		/**
+		 * @brief Provides reading access to the underlying value without copying it.
+		 * @return a reference to the underlying variable.
+		 */
+		TYPE_BUILDER_TRIVIAL constexpr const T& get_value_ref() const noexcept{
+			return value;
+		}
+		
 	protected:
 		
 		/**
 		 * @brief Sets the value of 'this'. 
 		 * @param value the new value
 		 */
-		void set_value(T value){
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR void set_value(T value)
+				noexcept(std::is_nothrow_move_assignable<T>::value){
 			this->value = value;
 		}
 };
@@ -681,20 +1125,24 @@ constexpr bool is_basic_number(){
 template<
 	typename Tlhs,
 	typename Trhs,
-	typename = typename std::enable_if<!is_basic_number<Tlhs>()>::type,
+	typename = typename std::enable_if<!is_basic_number<Tlhs>()
+		&& !impl::is_lazy_expression<Tlhs>::value>::type,
 	typename = typename std::enable_if<is_basic_number<Trhs>()>::type
 >
-auto operator+(const Tlhs& lhs, const Trhs& rhs ) -> decltype(rhs+lhs) {
+TYPE_BUILDER_TRIVIAL constexpr auto operator+(const Tlhs& lhs, const Trhs& rhs )
+		noexcept(noexcept(rhs+lhs)) -> decltype(rhs+lhs) {
 	return rhs+lhs;
 }
 
 template<
 	typename Tlhs,
 	typename Trhs,
-	typename = typename std::enable_if<!is_basic_number<Tlhs>()>::type,
+	typename = typename std::enable_if<!is_basic_number<Tlhs>()
+		&& !impl::is_lazy_expression<Tlhs>::value>::type,
 	typename = typename std::enable_if<is_basic_number<Trhs>()>::type
 >
-auto operator*(const Tlhs& lhs, const Trhs& rhs ) -> decltype(rhs*lhs) {
+TYPE_BUILDER_TRIVIAL constexpr auto operator*(const Tlhs& lhs, const Trhs& rhs )
+		noexcept(noexcept(rhs*lhs)) -> decltype(rhs*lhs) {
 	return rhs*lhs;
 }
 
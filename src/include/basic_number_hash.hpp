@@ -0,0 +1,68 @@
+#ifndef BASIC_NUMBER_HASH_HPP
+#define BASIC_NUMBER_HASH_HPP
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "basic_number_flags.hpp"
+
+// Not included by basic_number.hpp or safe_int.hpp, so that only the users of the
+// hashes parse <functional>; it only declares the numbers that it hashes.
+
+namespace type_builder{
+
+template<typename T, class Tid, flag_t Tflags, template<typename, class> class Tbase>
+class basic_number;
+
+template<typename T, typename Tpolicy>
+class safe_int;
+
+namespace impl{
+
+// The hash of a Tnumber with a value of T. Like std::hash of a type that cannot be
+// hashed it is disabled, if T cannot be hashed:
+template<typename Tnumber, typename T, typename = void>
+struct number_hash{
+	number_hash() = delete;
+	number_hash(const number_hash&) = delete;
+	number_hash& operator=(const number_hash&) = delete;
+};
+
+template<typename Tnumber, typename T>
+struct number_hash<Tnumber, T, decltype(void(std::hash<T>{}(std::declval<const T&>())))>{
+	typedef Tnumber argument_type;
+	typedef std::size_t result_type;
+
+	std::size_t operator()(const Tnumber& number) const
+			noexcept(noexcept(std::hash<T>{}(number.get_value()))){
+		return std::hash<T>{}(number.get_value());
+	}
+};
+
+} // namespace impl
+
+} // namespace type_builder
+
+namespace std{
+
+/**
+ * @brief Hashes a basic_number like its value, so that it can be the key of the
+ *        unordered containers without a hasher of its own.
+ */
+template<typename T, class Tid, type_builder::flag_t Tflags, template<typename, class> class Tbase>
+struct hash<type_builder::basic_number<T, Tid, Tflags, Tbase>>:
+	type_builder::impl::number_hash<type_builder::basic_number<T, Tid, Tflags, Tbase>, T>{};
+
+/**
+ * @brief Hashes a safe_int like its value; like the hash of basic_number it is
+ *        disabled if T cannot be hashed (as the 128 bit integers in strict ISO-mode).
+ */
+template<typename T, typename Tpolicy>
+struct hash<type_builder::safe_int<T, Tpolicy>>:
+	type_builder::impl::number_hash<type_builder::safe_int<T, Tpolicy>, T>{};
+
+} // namespace std
+
+#endif
@@ -0,0 +1,334 @@
+#ifndef BASIC_NUMBER_LAZY_HPP
+#define BASIC_NUMBER_LAZY_HPP
+
+#include <type_traits>
+
+#include "basic_number_core.hpp"
+
+namespace type_builder{
+
+// With ENABLE_LAZY_EVALUATION the operators +, -, * and / of a basic_number don't
+// compute anything, but return a lazy_expression that references the numbers and
+// copies the other operands. The expression is evaluated when it is assigned to a
+// number or used to construct one, directly in the value of that number and from
+// left to right, so that
+//
+//   a += tmp + (c + c);
+//
+// is executed as a += tmp; a += c; a += c; without any temporary. Only the result
+// of a multiplication or division that is added or subtracted is computed in a
+// temporary. Note that the expressions are reassociated that way: floating-point
+// results may round differently and signed integers may overflow in between, where
+// the eager operators wouldn't. If the target is an operand of the expression, it is
+// evaluated into a temporary first.
+//
+// The expressions reference the numbers, so they must not outlive the full-expression
+// in which they are created; don't store them in auto-variables. ENABLE_NATIVE_TYPING
+// has no effect on the lazy operators, the result always has the type of the numbers.
+
+namespace impl{
+
+// The operands of an expression apply themselves to the value of the target in place.
+// Those that are neither numbers nor expressions are the scalar factors and divisors:
+template<typename Toperand>
+struct lazy_operand{
+	template<typename T>
+	TYPE_BUILDER_TRIVIAL static TYPE_BUILDER_RELAXED_CONSTEXPR void multiply(T& target,
+			const Toperand& operand){
+		target *= operand;
+	}
+
+	template<typename T>
+	TYPE_BUILDER_TRIVIAL static TYPE_BUILDER_RELAXED_CONSTEXPR void divide(T& target,
+			const Toperand& operand){
+		target /= operand;
+	}
+
+	template<typename T>
+	TYPE_BUILDER_TRIVIAL static constexpr bool refers_to(const Toperand&, const T*){
+		return false;
+	}
+};
+
+template<typename T, class Tid, flag_t Tflags, template<typename, class> class Tbase>
+struct lazy_operand<basic_number<T, Tid, Tflags, Tbase>>{
+	using number_type = basic_number<T, Tid, Tflags, Tbase>;
+	using value_type = T;
+	static constexpr flag_t flags = Tflags;
+
+	TYPE_BUILDER_TRIVIAL static constexpr const T& evaluate(const number_type& operand){
+		return operand.value;
+	}
+
+	template<typename Ttarget>
+	TYPE_BUILDER_TRIVIAL static TYPE_BUILDER_RELAXED_CONSTEXPR void assign_to(Ttarget& target,
+			const number_type& operand){
+		target = operand.value;
+	}
+
+	template<typename Ttarget>
+	TYPE_BUILDER_TRIVIAL static TYPE_BUILDER_RELAXED_CONSTEXPR void add_to(Ttarget& target,
+			const number_type& operand){
+		target += operand.value;
+	}
+
+	template<typename Ttarget>
+	TYPE_BUILDER_TRIVIAL static TYPE_BUILDER_RELAXED_CONSTEXPR void subtract_from(Ttarget& target,
+			const number_type& operand){
+		target -= operand.value;
+	}
+
+	template<typename Ttarget>
+	TYPE_BUILDER_TRIVIAL static TYPE_BUILDER_RELAXED_CONSTEXPR void multiply(Ttarget& target,
+			const number_type& operand){
+		target *= operand.value;
+	}
+
+	template<typename Ttarget>
+	TYPE_BUILDER_TRIVIAL static TYPE_BUILDER_RELAXED_CONSTEXPR void divide(Ttarget& target,
+			const number_type& operand){
+		target /= operand.value;
+	}
+
+	template<typename Ttarget>
+	TYPE_BUILDER_TRIVIAL static constexpr bool refers_to(const number_type& operand,
+			const Ttarget* target){
+		return static_cast<const void*>(&operand.value) == static_cast<const void*>(target);
+	}
+};
+
+template<typename Top, typename Tlhs, typename Trhs>
+struct lazy_operand<lazy_expression<Top, Tlhs, Trhs>>{
+	using expression = lazy_expression<Top, Tlhs, Trhs>;
+	using number_type = typename expression::number_type;
+	using value_type = typename expression::value_type;
+	static constexpr flag_t flags = lazy_operand<Tlhs>::flags;
+
+	TYPE_BUILDER_TRIVIAL static TYPE_BUILDER_RELAXED_CONSTEXPR value_type evaluate(
+			const expression& operand){
+		return operand.evaluate();
+	}
+
+	TYPE_BUILDER_TRIVIAL static TYPE_BUILDER_RELAXED_CONSTEXPR void assign_to(value_type& target,
+			const expression& operand){
+		operand.assign_to(target);
+	}
+
+	TYPE_BUILDER_TRIVIAL static TYPE_BUILDER_RELAXED_CONSTEXPR void add_to(value_type& target,
+			const expression& operand){
+		operand.add_to(target);
+	}
+
+	TYPE_BUILDER_TRIVIAL static TYPE_BUILDER_RELAXED_CONSTEXPR void subtract_from(value_type& target,
+			const expression& operand){
+		operand.subtract_from(target);
+	}
+
+	// an expression that is a factor or a divisor is needed as a whole, so it is
+	// computed first:
+	TYPE_BUILDER_TRIVIAL static TYPE_BUILDER_RELAXED_CONSTEXPR void multiply(value_type& target,
+			const expression& operand){
+		target *= operand.evaluate();
+	}
+
+	TYPE_BUILDER_TRIVIAL static TYPE_BUILDER_RELAXED_CONSTEXPR void divide(value_type& target,
+			const expression& operand){
+		target /= operand.evaluate();
+	}
+
+	TYPE_BUILDER_TRIVIAL static constexpr bool refers_to(const expression& operand,
+			const value_type* target){
+		return operand.refers_to(target);
+	}
+};
+
+/**
+ * @brief The unevaluated result of lhs Top rhs, where lhs is a basic_number or
+ *        another expression of it.
+ */
+template<typename Top, typename Tlhs, typename Trhs>
+class lazy_expression{
+	public:
+		using number_type = typename lazy_operand<Tlhs>::number_type;
+		using value_type = typename lazy_operand<Tlhs>::value_type;
+
+	private:
+		// numbers are referenced, expressions and scalars are copied:
+		template<typename Toperand>
+		using storage = typename std::conditional<impl::is_basic_number<Toperand>::value,
+			const Toperand&, const Toperand>::type;
+
+		storage<Tlhs> lhs;
+		storage<Trhs> rhs;
+
+		// target Top= rhs:
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR void apply(lazy_plus, value_type& target) const {
+			lazy_operand<Trhs>::add_to(target, rhs);
+		}
+
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR void apply(lazy_minus, value_type& target) const {
+			lazy_operand<Trhs>::subtract_from(target, rhs);
+		}
+
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR void apply(lazy_multiplies, value_type& target) const {
+			lazy_operand<Trhs>::multiply(target, rhs);
+		}
+
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR void apply(lazy_divides, value_type& target) const {
+			lazy_operand<Trhs>::divide(target, rhs);
+		}
+
+		// target += *this:
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR void add(lazy_plus, value_type& target) const {
+			lazy_operand<Tlhs>::add_to(target, lhs);
+			lazy_operand<Trhs>::add_to(target, rhs);
+		}
+
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR void add(lazy_minus, value_type& target) const {
+			lazy_operand<Tlhs>::add_to(target, lhs);
+			lazy_operand<Trhs>::subtract_from(target, rhs);
+		}
+
+		template<typename Tproduct>
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR void add(Tproduct, value_type& target) const {
+			target += evaluate();
+		}
+
+		// target -= *this:
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR void subtract(lazy_plus, value_type& target) const {
+			lazy_operand<Tlhs>::subtract_from(target, lhs);
+			lazy_operand<Trhs>::subtract_from(target, rhs);
+		}
+
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR void subtract(lazy_minus, value_type& target) const {
+			lazy_operand<Tlhs>::subtract_from(target, lhs);
+			lazy_operand<Trhs>::add_to(target, rhs);
+		}
+
+		template<typename Tproduct>
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR void subtract(Tproduct, value_type& target) const {
+			target -= evaluate();
+		}
+
+		template<typename Tother>
+		static constexpr bool scalar_factor(){
+			return !impl::is_basic_number<Tother>::value && !is_lazy_expression<Tother>::value
+				&& number_type::template lazy_multiplication_permitted<Tother>();
+		}
+
+		template<typename Tother>
+		static constexpr bool comparable(flag_t flag){
+			return (lazy_operand<Tlhs>::flags & flag) != 0
+				&& number_type::template is_equivalent_basic_number<Tother>();
+		}
+
+	public:
+		TYPE_BUILDER_TRIVIAL constexpr lazy_expression(const Tlhs& lhs, const Trhs& rhs)
+			: lhs(lhs), rhs(rhs) {}
+
+		/**
+		 * @brief Computes the value of the expression.
+		 */
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR value_type evaluate() const {
+			value_type result = lazy_operand<Tlhs>::evaluate(lhs);
+			apply(Top{}, result);
+			return result;
+		}
+
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR value_type get_value() const {
+			return evaluate();
+		}
+
+		/**
+		 * @brief Overwrites target with the value of the expression, which must not
+		 *        refer to it.
+		 */
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR void assign_to(value_type& target) const {
+			lazy_operand<Tlhs>::assign_to(target, lhs);
+			apply(Top{}, target);
+		}
+
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR void add_to(value_type& target) const {
+			add(Top{}, target);
+		}
+
+		TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR void subtract_from(value_type& target) const {
+			subtract(Top{}, target);
+		}
+
+		/**
+		 * @brief Checks whether target is one of the values of the expression.
+		 */
+		TYPE_BUILDER_TRIVIAL constexpr bool refers_to(const value_type* target) const {
+			return lazy_operand<Tlhs>::refers_to(lhs, target)
+				|| lazy_operand<Trhs>::refers_to(rhs, target);
+		}
+
+		// the operators of expressions have the same conditions as those of the
+		// numbers:
+
+		TYPE_BUILDER_TEMPLATE(Tother, true,
+			number_type::template lazy_plus_minus_permitted<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr lazy_expression<lazy_plus, lazy_expression, Tother>
+		operator+(const Tother& other) const {
+			return {*this, other};
+		}
+
+		TYPE_BUILDER_TEMPLATE(Tother, true,
+			number_type::template lazy_plus_minus_permitted<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr lazy_expression<lazy_minus, lazy_expression, Tother>
+		operator-(const Tother& other) const {
+			return {*this, other};
+		}
+
+		TYPE_BUILDER_TEMPLATE(Tother, true,
+			number_type::template lazy_multiplication_permitted<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr lazy_expression<lazy_multiplies, lazy_expression, Tother>
+		operator*(const Tother& other) const {
+			return {*this, other};
+		}
+
+		TYPE_BUILDER_TEMPLATE(Tother, true,
+			number_type::template lazy_division_permitted<Tother>())
+		TYPE_BUILDER_TRIVIAL constexpr lazy_expression<lazy_divides, lazy_expression, Tother>
+		operator/(const Tother& other) const {
+			return {*this, other};
+		}
+
+		// scalar * expression, since * is assumed to be commutative:
+		TYPE_BUILDER_TEMPLATE(Tother, true, scalar_factor<Tother>())
+		TYPE_BUILDER_TRIVIAL friend constexpr lazy_expression<lazy_multiplies, lazy_expression, Tother>
+		operator*(const Tother& lhs, const lazy_expression& rhs) {
+			return {rhs, lhs};
+		}
+
+		// comparisons with numbers on either side or with other expressions, that
+		// compare the value of the expression:
+#define TYPE_BUILDER_LAZY_COMPARISON(Top, Tflag) \
+		TYPE_BUILDER_TEMPLATE(Tother, true, comparable<Tother>(Tflag)) \
+		TYPE_BUILDER_TRIVIAL friend TYPE_BUILDER_RELAXED_CONSTEXPR bool operator Top( \
+				const lazy_expression& lhs, const Tother& rhs) { \
+			return lhs.evaluate() Top lazy_operand<Tother>::evaluate(rhs); \
+		} \
+		\
+		TYPE_BUILDER_TEMPLATE(Tother, true, \
+			!is_lazy_expression<Tother>::value && comparable<Tother>(Tflag)) \
+		TYPE_BUILDER_TRIVIAL friend TYPE_BUILDER_RELAXED_CONSTEXPR bool operator Top( \
+				const Tother& lhs, const lazy_expression& rhs) { \
+			return lazy_operand<Tother>::evaluate(lhs) Top rhs.evaluate(); \
+		}
+
+		TYPE_BUILDER_LAZY_COMPARISON(==, ENABLE_SPECIFIC_EQUALITY_CHECK)
+		TYPE_BUILDER_LAZY_COMPARISON(!=, ENABLE_SPECIFIC_EQUALITY_CHECK)
+		TYPE_BUILDER_LAZY_COMPARISON(<, ENABLE_SPECIFIC_ORDERING_O_)
+		TYPE_BUILDER_LAZY_COMPARISON(<=, ENABLE_SPECIFIC_ORDERING_O_)
+		TYPE_BUILDER_LAZY_COMPARISON(>, ENABLE_SPECIFIC_ORDERING_O_)
+		TYPE_BUILDER_LAZY_COMPARISON(>=, ENABLE_SPECIFIC_ORDERING_O_)
+#undef TYPE_BUILDER_LAZY_COMPARISON
+};
+
+} // namespace impl
+
+} // namespace type_builder
+
+#endif
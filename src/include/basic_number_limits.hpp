@@ -0,0 +1,61 @@
+#ifndef BASIC_NUMBER_LIMITS_HPP
+#define BASIC_NUMBER_LIMITS_HPP
+
+#include <limits>
+
+#include "basic_number_core.hpp"
+
+namespace std{
+
+/**
+ * @brief The limits of a basic_number are those of its value.
+ *
+ * The constants are inherited from the limits of T and the functions return the
+ * values of them as numbers, so that generic code that asks for the range of a type
+ * works with numbers like with the built-in types.
+ */
+template<typename T, class Tid, type_builder::flag_t Tflags, template<typename, class> class Tbase>
+class numeric_limits<type_builder::basic_number<T, Tid, Tflags, Tbase>>: public numeric_limits<T>{
+	using number = type_builder::basic_number<T, Tid, Tflags, Tbase>;
+
+	public:
+		static constexpr number min() noexcept{
+			return number{numeric_limits<T>::min()};
+		}
+
+		static constexpr number max() noexcept{
+			return number{numeric_limits<T>::max()};
+		}
+
+		static constexpr number lowest() noexcept{
+			return number{numeric_limits<T>::lowest()};
+		}
+
+		static constexpr number epsilon() noexcept{
+			return number{numeric_limits<T>::epsilon()};
+		}
+
+		static constexpr number round_error() noexcept{
+			return number{numeric_limits<T>::round_error()};
+		}
+
+		static constexpr number infinity() noexcept{
+			return number{numeric_limits<T>::infinity()};
+		}
+
+		static constexpr number quiet_NaN() noexcept{
+			return number{numeric_limits<T>::quiet_NaN()};
+		}
+
+		static constexpr number signaling_NaN() noexcept{
+			return number{numeric_limits<T>::signaling_NaN()};
+		}
+
+		static constexpr number denorm_min() noexcept{
+			return number{numeric_limits<T>::denorm_min()};
+		}
+};
+
+} // namespace std
+
+#endif
@@ -0,0 +1,299 @@
+#ifndef BASIC_NUMBER_OVERFLOW_HPP
+#define BASIC_NUMBER_OVERFLOW_HPP
+
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "basic_number_core.hpp"
+#include "safe_int_policies.hpp"
+
+namespace type_builder{
+
+namespace impl{
+
+/**
+ * @brief The arithmetic of integers with ENABLE_OVERFLOW_CHECK.
+ *
+ * The operations are checked with the builtins of the compiler, that compile to the
+ * operation and a branch on its overflow-flag, and the result must fit into Tresult.
+ * Overflows and divisions by zero are passed to Tpolicy like in safe_int; the
+ * wrapped value it is given is the saturated one.
+ */
+template<typename Tresult, typename Tpolicy>
+struct checked_arithmetic{
+	private:
+		static constexpr Tresult min(){
+			return std::numeric_limits<Tresult>::min();
+		}
+
+		static constexpr Tresult max(){
+			return std::numeric_limits<Tresult>::max();
+		}
+
+		template<typename Targ>
+		static constexpr bool is_negative(const Targ& value, std::true_type){
+			return value < Targ{0};
+		}
+
+		template<typename Targ>
+		static constexpr bool is_negative(const Targ&, std::false_type){
+			return false;
+		}
+
+		template<typename Targ>
+		static constexpr bool is_negative(const Targ& value){
+			return is_negative(value, std::is_signed<Targ>{});
+		}
+
+		// The signs of the exact sum and difference, which tell whether a result that
+		// doesn't fit into Tresult is too large or too small, even if Tresult is
+		// unsigned and an operand negative. Values of the same sign keep their order
+		// when they are converted to the unsigned type of both:
+		template<typename Tlhs, typename Trhs>
+		using unsigned_of = typename std::make_unsigned<typename std::common_type<Tlhs, Trhs>::type>::type;
+
+		template<typename Tunsigned, typename Targ>
+		static constexpr Tunsigned magnitude(const Targ& value){
+			return is_negative(value) ?
+				static_cast<Tunsigned>(Tunsigned{0} - static_cast<Tunsigned>(value)) :
+				static_cast<Tunsigned>(value);
+		}
+
+		template<typename Tlhs, typename Trhs>
+		static constexpr bool sum_is_negative(const Tlhs& lhs, const Trhs& rhs){
+			return is_negative(lhs) == is_negative(rhs) ? is_negative(lhs) :
+				is_negative(lhs) ?
+					magnitude<unsigned_of<Tlhs, Trhs>>(lhs) > magnitude<unsigned_of<Tlhs, Trhs>>(rhs) :
+					magnitude<unsigned_of<Tlhs, Trhs>>(rhs) > magnitude<unsigned_of<Tlhs, Trhs>>(lhs);
+		}
+
+		template<typename Tlhs, typename Trhs>
+		static constexpr bool difference_is_negative(const Tlhs& lhs, const Trhs& rhs){
+			return is_negative(lhs) != is_negative(rhs) ? is_negative(lhs) :
+				static_cast<unsigned_of<Tlhs, Trhs>>(lhs) < static_cast<unsigned_of<Tlhs, Trhs>>(rhs);
+		}
+
+		static constexpr Tresult range_error(bool overflow){
+			return overflow ?
+				Tpolicy::template on_error<std::overflow_error>(max(), max(), "overflow of basic_number") :
+				Tpolicy::template on_error<std::underflow_error>(min(), min(), "underflow of basic_number");
+		}
+
+#if defined(TYPE_BUILDER_HAS_OVERFLOW_PREDICATES)
+		// the builtins compute the exact results of operands of different types:
+		template<typename Tlhs, typename Trhs>
+		static constexpr bool add_overflows(Tlhs lhs, Trhs rhs){
+			return __builtin_add_overflow_p(lhs, rhs, Tresult{});
+		}
+
+		template<typename Tlhs, typename Trhs>
+		static constexpr bool sub_overflows(Tlhs lhs, Trhs rhs){
+			return __builtin_sub_overflow_p(lhs, rhs, Tresult{});
+		}
+
+		template<typename Tlhs, typename Trhs>
+		static constexpr bool mul_overflows(Tlhs lhs, Trhs rhs){
+			return __builtin_mul_overflow_p(lhs, rhs, Tresult{});
+		}
+
+		template<typename Targ>
+		static constexpr bool conversion_overflows(Targ value){
+			return __builtin_add_overflow_p(value, 0, Tresult{});
+		}
+#elif defined(TYPE_BUILDER_HAS_OVERFLOW_BUILTINS)
+		template<typename Tlhs, typename Trhs>
+		static constexpr bool add_overflows(Tlhs lhs, Trhs rhs){
+			Tresult result{};
+			return __builtin_add_overflow(lhs, rhs, &result);
+		}
+
+		template<typename Tlhs, typename Trhs>
+		static constexpr bool sub_overflows(Tlhs lhs, Trhs rhs){
+			Tresult result{};
+			return __builtin_sub_overflow(lhs, rhs, &result);
+		}
+
+		template<typename Tlhs, typename Trhs>
+		static constexpr bool mul_overflows(Tlhs lhs, Trhs rhs){
+			Tresult result{};
+			return __builtin_mul_overflow(lhs, rhs, &result);
+		}
+
+		template<typename Targ>
+		static constexpr bool conversion_overflows(Targ value){
+			Tresult result{};
+			return __builtin_add_overflow(value, 0, &result);
+		}
+#else
+		// the portable checks of safe_int.hpp, that need operands of Tresult, so that
+		// an operand that doesn't fit into it is reported even if the result would:
+		template<typename Targ>
+		static constexpr bool conversion_overflows(Targ value){
+			return is_negative(value) ?
+				(!std::is_signed<Tresult>::value || (sizeof(Targ) > sizeof(Tresult)
+					&& value < static_cast<Targ>(min()))) :
+				static_cast<typename std::make_unsigned<Targ>::type>(value)
+					> static_cast<typename std::make_unsigned<Tresult>::type>(max());
+		}
+
+		static constexpr bool add_overflows_of(Tresult lhs, Tresult rhs){
+			return is_negative(rhs) ? lhs < min() - rhs : lhs > max() - rhs;
+		}
+
+		static constexpr bool sub_overflows_of(Tresult lhs, Tresult rhs){
+			return is_negative(rhs) ? lhs > max() + rhs : lhs < min() + rhs;
+		}
+
+		static constexpr bool mul_overflows_of(Tresult lhs, Tresult rhs){
+			return (lhs == 0 || rhs == 0) ? false :
+				is_negative(lhs) ?
+					(is_negative(rhs) ? lhs < max() / rhs : lhs < min() / rhs) :
+					(is_negative(rhs) ? rhs < min() / lhs : lhs > max() / rhs);
+		}
+
+		template<typename Tlhs, typename Trhs>
+		static constexpr bool add_overflows(Tlhs lhs, Trhs rhs){
+			return conversion_overflows(lhs) || conversion_overflows(rhs)
+				|| add_overflows_of(static_cast<Tresult>(lhs), static_cast<Tresult>(rhs));
+		}
+
+		template<typename Tlhs, typename Trhs>
+		static constexpr bool sub_overflows(Tlhs lhs, Trhs rhs){
+			return conversion_overflows(lhs) || conversion_overflows(rhs)
+				|| sub_overflows_of(static_cast<Tresult>(lhs), static_cast<Tresult>(rhs));
+		}
+
+		template<typename Tlhs, typename Trhs>
+		static constexpr bool mul_overflows(Tlhs lhs, Trhs rhs){
+			return conversion_overflows(lhs) || conversion_overflows(rhs)
+				|| mul_overflows_of(static_cast<Tresult>(lhs), static_cast<Tresult>(rhs));
+		}
+#endif
+
+		static constexpr bool div_overflows(Tresult lhs, Tresult rhs){
+			return std::is_signed<Tresult>::value && lhs == min() && rhs == static_cast<Tresult>(-1);
+		}
+
+		// the quotients are computed in Tresult, like those of safe_int:
+		static constexpr Tresult checked_divides(Tresult lhs, Tresult rhs){
+			return rhs == 0 ?
+				Tpolicy::template on_error<std::domain_error>(
+					is_negative(lhs) ? min() : lhs == 0 ? Tresult{0} : max(),
+					is_negative(lhs) ? min() : lhs == 0 ? Tresult{0} : max(),
+					"integer-division by 0") :
+				div_overflows(lhs, rhs) ? range_error(true) : static_cast<Tresult>(lhs / rhs);
+		}
+
+		static constexpr Tresult checked_modulus(Tresult lhs, Tresult rhs){
+			return rhs == 0 ?
+				Tpolicy::template on_error<std::domain_error>(lhs, lhs, "modulo of 0") :
+				div_overflows(lhs, rhs) ? Tresult{0} : static_cast<Tresult>(lhs % rhs);
+		}
+
+	public:
+		// converts an exact result that was computed in another type, like the
+		// products of scale:
+		template<typename Targ>
+		static constexpr Tresult convert(const Targ& value){
+			return conversion_overflows(value) ?
+				range_error(!is_negative(value)) : static_cast<Tresult>(value);
+		}
+
+		template<typename Tlhs, typename Trhs>
+		static constexpr Tresult plus(const Tlhs& lhs, const Trhs& rhs){
+			return add_overflows(lhs, rhs) ?
+				range_error(!sum_is_negative(lhs, rhs)) : static_cast<Tresult>(lhs + rhs);
+		}
+
+		template<typename Tlhs, typename Trhs>
+		static constexpr Tresult minus(const Tlhs& lhs, const Trhs& rhs){
+			return sub_overflows(lhs, rhs) ?
+				range_error(!difference_is_negative(lhs, rhs)) : static_cast<Tresult>(lhs - rhs);
+		}
+
+		template<typename Tlhs, typename Trhs>
+		static constexpr Tresult multiplies(const Tlhs& lhs, const Trhs& rhs){
+			return mul_overflows(lhs, rhs) ?
+				range_error(is_negative(lhs) == is_negative(rhs)) : static_cast<Tresult>(lhs * rhs);
+		}
+
+		template<typename Tlhs, typename Trhs>
+		static constexpr Tresult divides(const Tlhs& lhs, const Trhs& rhs){
+			return checked_divides(convert(lhs), convert(rhs));
+		}
+
+		template<typename Tlhs, typename Trhs>
+		static constexpr Tresult modulus(const Tlhs& lhs, const Trhs& rhs){
+			return checked_modulus(convert(lhs), convert(rhs));
+		}
+
+		// a divisor is never 0, but min / -1 overflows just the same:
+		template<typename Tlhs>
+		static constexpr Tresult divides(const Tlhs& lhs, const divisor<Tresult>& rhs){
+			return div_overflows(convert(lhs), rhs.get_value()) ?
+				range_error(true) : static_cast<Tresult>(convert(lhs) / rhs);
+		}
+
+		template<typename Tlhs>
+		static constexpr Tresult modulus(const Tlhs& lhs, const divisor<Tresult>& rhs){
+			return div_overflows(convert(lhs), rhs.get_value()) ?
+				Tresult{0} : static_cast<Tresult>(convert(lhs) % rhs);
+		}
+
+		template<typename Targ>
+		static constexpr Tresult negate(const Targ& value){
+			return minus(Tresult{0}, value);
+		}
+
+		template<typename Trhs>
+		static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult& plus_assign(Tresult& lhs, const Trhs& rhs){
+			return lhs = plus(lhs, rhs);
+		}
+
+		template<typename Trhs>
+		static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult& minus_assign(Tresult& lhs, const Trhs& rhs){
+			return lhs = minus(lhs, rhs);
+		}
+
+		template<typename Trhs>
+		static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult& multiplies_assign(Tresult& lhs, const Trhs& rhs){
+			return lhs = multiplies(lhs, rhs);
+		}
+
+		template<typename Trhs>
+		static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult& divides_assign(Tresult& lhs, const Trhs& rhs){
+			return lhs = divides(lhs, rhs);
+		}
+
+		template<typename Trhs>
+		static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult& modulus_assign(Tresult& lhs, const Trhs& rhs){
+			return lhs = modulus(lhs, rhs);
+		}
+
+		static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult& increment(Tresult& value){
+			return value = plus(value, Tresult{1});
+		}
+
+		static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult& decrement(Tresult& value){
+			return value = minus(value, Tresult{1});
+		}
+
+		static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult post_increment(Tresult& value){
+			const Tresult old = value;
+			increment(value);
+			return old;
+		}
+
+		static TYPE_BUILDER_RELAXED_CONSTEXPR Tresult post_decrement(Tresult& value){
+			const Tresult old = value;
+			decrement(value);
+			return old;
+		}
+};
+
+} // namespace impl
+
+} // namespace type_builder
+
+#endif
@@ -0,0 +1,197 @@
+#ifndef BASIC_NUMBER_SCALE_HPP
+#define BASIC_NUMBER_SCALE_HPP
+
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+#include "basic_number_core.hpp"
+
+namespace type_builder{
+
+/**
+ * @brief How the product of an integer and a scale is rounded.
+ */
+enum class rounding{
+	toward_zero,
+	down,
+	up,
+	to_nearest // ties away from zero
+};
+
+/**
+ * @brief A factor that is known at compile-time, for integral numbers:
+ *
+ *   Int tmp = b * type_builder::scale<std::ratio<7, 2>>{};
+ *
+ * computes b * 7 / 2 exactly with integer-operations only, whose divisions by the
+ * constant denominator the compiler replaces by multiplications and shifts. The
+ * product is rounded as Tmode says. It only overflows if the result does, which
+ * is checked with ENABLE_OVERFLOW_CHECK like in the other operators.
+ */
+template<typename Tratio, rounding Tmode = rounding::toward_zero>
+struct scale{
+	using ratio = typename Tratio::type;
+	static constexpr rounding mode = Tmode;
+};
+
+namespace impl{
+
+template<typename T>
+constexpr bool scale_is_negative(T value, std::true_type){
+	return value < T{0};
+}
+
+template<typename T>
+constexpr bool scale_is_negative(T, std::false_type){
+	return false;
+}
+
+template<typename T>
+constexpr bool scale_is_negative(T value){
+	return scale_is_negative(value, std::is_signed<T>{});
+}
+
+// Rounds quotient = dividend / divisor, that was truncated toward zero, with the
+// remainder of that division (which has the sign of the dividend):
+template<rounding Tmode, typename T>
+constexpr T round_quotient(T quotient, T remainder, T divisor){
+	return Tmode == rounding::down
+			? quotient - T(scale_is_negative(remainder) ? 1 : 0)
+		: Tmode == rounding::up
+			? quotient + T(!scale_is_negative(remainder) && remainder != T{0} ? 1 : 0)
+		: Tmode == rounding::to_nearest
+			// |remainder| >= divisor / 2, without overflows:
+			? (scale_is_negative(remainder)
+				? quotient - T(T{0} - remainder >= divisor + remainder ? 1 : 0)
+				: quotient + T(remainder >= divisor - remainder ? 1 : 0))
+		: quotient;
+}
+
+template<typename T, std::intmax_t Tnum>
+constexpr bool fits_factor(){
+	return Tnum >= 0
+		? static_cast<std::uintmax_t>(Tnum)
+			<= static_cast<std::uintmax_t>(std::numeric_limits<T>::max())
+		: std::is_signed<T>::value
+			&& Tnum >= static_cast<std::intmax_t>(std::numeric_limits<T>::min()) + 1;
+}
+
+// A type that holds value * num exactly for every value of T, if there is one:
+template<typename T>
+using wider_integer = typename std::conditional<(sizeof(T) < sizeof(std::intmax_t)),
+	typename std::conditional<std::is_signed<T>::value, std::intmax_t, std::uintmax_t>::type,
+	void>::type;
+
+template<typename T, std::intmax_t Tnum, std::intmax_t Tden, rounding Tmode>
+constexpr T scale_product(T product){
+	return round_quotient<Tmode>(T(product / T(Tden)), T(product % T(Tden)), T(Tden));
+}
+
+// Small integers are multiplied in a wider type, where the division by the constant
+// denominator is a single multiplication:
+template<typename Tratio, rounding Tmode, typename T>
+constexpr T scale_value(T value, std::true_type){
+	return T(scale_product<wider_integer<T>, Tratio::num, Tratio::den, Tmode>(
+		wider_integer<T>(value) * Tratio::num));
+}
+
+// Otherwise value = a * den + b gives value * num / den = a * num + b * num / den,
+// where |b * num| < den * |num|, so that only a * num can overflow, just like the
+// exact result:
+template<typename Tratio, rounding Tmode, typename T>
+constexpr T scale_value(T value, std::false_type){
+	return T(T(value / T(Tratio::den)) * T(Tratio::num))
+		+ scale_product<T, Tratio::num, Tratio::den, Tmode>(
+			T(T(value % T(Tratio::den)) * T(Tratio::num)));
+}
+
+// With ENABLE_OVERFLOW_CHECK the same steps are checked by the arithmetic of the
+// flags (see basic_number_overflow.hpp): the exact product of small integers is
+// converted with a check, the two parts of the others are multiplied and added with
+// checks. Both parts have the sign of the exact result, so that a saturated first
+// part stays saturated.
+template<typename Tratio, rounding Tmode, typename Tarithmetic, typename T>
+constexpr T checked_scale_value(T value, std::true_type){
+	return Tarithmetic::convert(scale_product<wider_integer<T>, Tratio::num, Tratio::den, Tmode>(
+		wider_integer<T>(value) * Tratio::num));
+}
+
+template<typename Tratio, rounding Tmode, typename Tarithmetic, typename T>
+constexpr T checked_scale_value(T value, std::false_type){
+	return Tarithmetic::plus(Tarithmetic::multiplies(T(value / T(Tratio::den)), T(Tratio::num)),
+		scale_product<T, Tratio::num, Tratio::den, Tmode>(
+			T(T(value % T(Tratio::den)) * T(Tratio::num))));
+}
+
+template<bool Tchecked>
+struct scale_arithmetic{
+	template<typename Tratio, rounding Tmode, flag_t Tflags, typename T>
+	static constexpr T apply(T value){
+		return scale_value<Tratio, Tmode>(value, std::integral_constant<bool,
+			(sizeof(T) < sizeof(std::intmax_t))>{});
+	}
+};
+
+template<>
+struct scale_arithmetic<true>{
+	template<typename Tratio, rounding Tmode, flag_t Tflags, typename T>
+	static constexpr T apply(T value){
+		return checked_scale_value<Tratio, Tmode,
+			checked_arithmetic<T, typename overflow_policy<Tflags>::type>>(
+				value, std::integral_constant<bool, (sizeof(T) < sizeof(std::intmax_t))>{});
+	}
+};
+
+template<typename Tratio, rounding Tmode, flag_t Tflags, typename T>
+constexpr T scale_value(T value){
+	static_assert(std::is_integral<T>::value, "only integers can be scaled");
+	static_assert(fits_factor<T, Tratio::num>() && fits_factor<T, Tratio::den>()
+			&& (Tratio::num == 0 || (Tratio::den
+				<= static_cast<std::intmax_t>(std::numeric_limits<T>::max())
+					/ (Tratio::num < 0 ? -Tratio::num : Tratio::num)
+				&& Tratio::den <= static_cast<std::intmax_t>(std::numeric_limits<T>::max()) / 2)),
+			"the scale is too large for the type of the value");
+	return scale_arithmetic<(Tflags & ENABLE_OVERFLOW_CHECK) != 0>::template apply<Tratio, Tmode, Tflags>(value);
+}
+
+}
+
+// basic_number * scale
+template<typename T, class Tid, flag_t Tflags, template<typename, class> class Tbase,
+	typename Tratio, rounding Tmode>
+TYPE_BUILDER_TRIVIAL constexpr auto operator*(const basic_number<T, Tid, Tflags, Tbase>& number,
+		scale<Tratio, Tmode>) noexcept((Tflags & ENABLE_OVERFLOW_CHECK) == 0)
+	-> typename std::enable_if<(Tflags & ENABLE_INTEGER_MULTIPLICATION) != 0
+		&& std::is_integral<T>::value, basic_number<T, Tid, Tflags, Tbase>>::type
+{
+	return basic_number<T, Tid, Tflags, Tbase>{
+		impl::scale_value<typename Tratio::type, Tmode, Tflags>(number.get_value_ref())};
+}
+
+// scale * basic_number
+template<typename T, class Tid, flag_t Tflags, template<typename, class> class Tbase,
+	typename Tratio, rounding Tmode>
+TYPE_BUILDER_TRIVIAL constexpr auto operator*(scale<Tratio, Tmode> factor,
+		const basic_number<T, Tid, Tflags, Tbase>& number) noexcept((Tflags & ENABLE_OVERFLOW_CHECK) == 0)
+	-> decltype(number * factor)
+{
+	return number * factor;
+}
+
+// basic_number *= scale
+template<typename T, class Tid, flag_t Tflags, template<typename, class> class Tbase,
+	typename Tratio, rounding Tmode>
+TYPE_BUILDER_TRIVIAL TYPE_BUILDER_RELAXED_CONSTEXPR auto operator*=(
+		basic_number<T, Tid, Tflags, Tbase>& number, scale<Tratio, Tmode> factor)
+		noexcept((Tflags & ENABLE_OVERFLOW_CHECK) == 0)
+	-> typename std::enable_if<(Tflags & DISABLE_MUTABILITY) == 0,
+		decltype(number = number * factor)>::type
+{
+	return number = number * factor;
+}
+
+} // namespace type_builder
+
+#endif
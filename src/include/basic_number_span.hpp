@@ -0,0 +1,80 @@
+#ifndef BASIC_NUMBER_SPAN_HPP
+#define BASIC_NUMBER_SPAN_HPP
+
+#include <type_traits>
+
+#include "basic_number_core.hpp"
+#include "span.hpp"
+
+namespace type_builder{
+
+namespace impl{
+
+template<typename Tnumber>
+struct underlying_type{};
+
+template<typename T, class Tid, flag_t Tflags, template<typename, class> class Tbase>
+struct underlying_type<basic_number<T, Tid, Tflags, Tbase>>{
+	using type = T;
+};
+
+template<typename Tnumber>
+struct underlying_type<const Tnumber>{
+	using type = const typename underlying_type<Tnumber>::type;
+};
+
+// An array of Tnumber can only be viewed as an array of its values if the number
+// has nothing else in it and its bytes are just those of the value:
+template<typename Tnumber>
+constexpr bool has_layout_of_underlying(){
+	using T = typename std::remove_const<typename underlying_type<Tnumber>::type>::type;
+	using number = typename std::remove_const<Tnumber>::type;
+	return sizeof(number) == sizeof(T) && alignof(number) == alignof(T)
+		&& std::is_standard_layout<number>::value
+		&& std::is_trivially_copyable<number>::value && std::is_trivially_copyable<T>::value;
+}
+
+}
+
+/**
+ * @brief Returns a view of the values of the numbers without copying them.
+ *
+ * This requires that the numbers consist of nothing but their value, which is
+ * checked at compile-time; it holds for all basic_numbers with an empty base and
+ * a trivially copyable T.
+ */
+template<typename Tnumber, typename = typename std::enable_if<
+	is_basic_number<typename std::remove_const<Tnumber>::type>()>::type>
+span<typename impl::underlying_type<Tnumber>::type> as_underlying(span<Tnumber> numbers){
+	static_assert(impl::has_layout_of_underlying<Tnumber>(),
+			"the layout of the number-type differs from the one of its value");
+	using T = typename impl::underlying_type<Tnumber>::type;
+	return span<T>{reinterpret_cast<T*>(numbers.data()), numbers.size()};
+}
+
+/**
+ * @brief Returns a view of the values as numbers of type Tnumber without copying
+ *        them; the reverse of as_underlying().
+ *
+ * Besides the layout it is checked that the values could be converted into
+ * Tnumbers explicitly and are of exactly its underlying type, so that no
+ * conversion is skipped.
+ */
+template<typename Tnumber, typename T>
+span<typename std::conditional<std::is_const<T>::value, const Tnumber, Tnumber>::type>
+as_numbers(span<T> values){
+	static_assert(is_basic_number<Tnumber>(), "the target-type must be a basic_number");
+	static_assert(std::is_same<typename std::remove_const<T>::type,
+			typename impl::underlying_type<Tnumber>::type>::value,
+			"the values must be of the underlying type of the number-type");
+	static_assert(std::is_constructible<Tnumber, const typename std::remove_const<T>::type&>::value,
+			"the number-type cannot be constructed from its underlying type");
+	static_assert(impl::has_layout_of_underlying<Tnumber>(),
+			"the layout of the number-type differs from the one of its value");
+	using number = typename std::conditional<std::is_const<T>::value, const Tnumber, Tnumber>::type;
+	return span<number>{reinterpret_cast<number*>(values.data()), values.size()};
+}
+
+} //namespace type_builder
+
+#endif
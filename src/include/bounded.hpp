@@ -0,0 +1,557 @@
+#ifndef TYPE_BUILDER_BOUNDED_HPP
+#define TYPE_BUILDER_BOUNDED_HPP
+
+#include <type_traits>
+#include <cstdint>
+#include <limits>
+#include <climits>
+#include <stdexcept>
+#include <iosfwd>
+
+#include "safe_int.hpp"
+
+#if defined(__GNUC__)
+#	define TYPE_BUILDER_UNREACHABLE() __builtin_unreachable()
+#else
+#	define TYPE_BUILDER_UNREACHABLE() static_cast<void>(0)
+#endif
+
+namespace type_builder {
+
+template<typename T, T Tlo, T Thi, typename Tpolicy = throw_on_error> class bounded;
+
+namespace impl{
+
+// All bounds are computed in the widest standard integer-type; bounded therefore
+// only supports bounds that are representable in it.
+typedef std::intmax_t bound_t;
+
+struct bounded_access;
+
+// The types in which values of T are compared with a bound; they are wider than
+// bound_t for the 128 bit integers:
+template<typename T>
+struct bound_comparison{
+	typedef typename std::conditional<(sizeof(T) > sizeof(bound_t)), T, bound_t>::type negative;
+	typedef typename std::conditional<(sizeof(T) > sizeof(bound_t)),
+		typename impl::make_unsigned<T>::type, std::uintmax_t>::type non_negative;
+};
+
+// exact comparisions of any integral value with a bound:
+template<typename T>
+constexpr bool below_bound(const T& value, bound_t bound){
+	return is_negative(value) ?
+		(bound >= 0 || static_cast<typename bound_comparison<T>::negative>(value)
+			< static_cast<typename bound_comparison<T>::negative>(bound)) :
+		(bound > 0 && static_cast<typename bound_comparison<T>::non_negative>(value)
+			< static_cast<typename bound_comparison<T>::non_negative>(bound));
+}
+
+template<typename T>
+constexpr bool above_bound(const T& value, bound_t bound){
+	return is_negative(value) ?
+		(bound < 0 && static_cast<typename bound_comparison<T>::negative>(value)
+			> static_cast<typename bound_comparison<T>::negative>(bound)) :
+		(bound < 0 || static_cast<typename bound_comparison<T>::non_negative>(value)
+			> static_cast<typename bound_comparison<T>::non_negative>(bound));
+}
+
+template<typename T>
+constexpr bound_t bound_min(){
+	return below_bound(std::numeric_limits<T>::min(), std::numeric_limits<bound_t>::min()) ?
+		std::numeric_limits<bound_t>::min() :
+		static_cast<bound_t>(std::numeric_limits<T>::min());
+}
+
+template<typename T>
+constexpr bound_t bound_max(){
+	return above_bound(std::numeric_limits<T>::max(), std::numeric_limits<bound_t>::max()) ?
+		std::numeric_limits<bound_t>::max() :
+		static_cast<bound_t>(std::numeric_limits<T>::max());
+}
+
+constexpr bound_t clamp_bound(bound_t value, bound_t lo, bound_t hi){
+	return value < lo ? lo : value > hi ? hi : value;
+}
+
+constexpr bound_t min_bound(bound_t a, bound_t b){
+	return a < b ? a : b;
+}
+
+constexpr bound_t max_bound(bound_t a, bound_t b){
+	return a < b ? b : a;
+}
+
+constexpr bound_t saturating_add(bound_t lhs, bound_t rhs){
+	return add_overflows(lhs, rhs) ?
+		(rhs < 0 ? bound_min<bound_t>() : bound_max<bound_t>()) :
+		lhs + rhs;
+}
+
+constexpr bound_t saturating_sub(bound_t lhs, bound_t rhs){
+	return sub_overflows(lhs, rhs) ?
+		(rhs < 0 ? bound_max<bound_t>() : bound_min<bound_t>()) :
+		lhs - rhs;
+}
+
+constexpr bound_t saturating_mul(bound_t lhs, bound_t rhs){
+	return mul_overflows(lhs, rhs) ?
+		((lhs < 0) == (rhs < 0) ? bound_max<bound_t>() : bound_min<bound_t>()) :
+		lhs * rhs;
+}
+
+constexpr bound_t saturating_div(bound_t lhs, bound_t rhs){
+	return div_overflows(lhs, rhs) ? bound_max<bound_t>() : lhs / rhs;
+}
+
+// The interval-arithmetic: every operation provides the bounds of the result
+// (saturated to bound_t), whether they are exact and the runtime-operation.
+// The runtime-operations only check for overflows if Tchecked is true, which is only
+// the case if the exact result doesn't fit into the largest available type. Since
+// the bounds of such a result are saturated, a value that doesn't overflow the
+// storage may still lie outside of them, so it is checked against them as well.
+
+template<typename Tpolicy, typename T>
+constexpr T within_bounds(T value, T lo, T hi){
+	return value < lo ? Tpolicy::template on_error<std::underflow_error>(lo, lo, "") :
+		value > hi ? Tpolicy::template on_error<std::overflow_error>(hi, hi, "") :
+		value;
+}
+
+struct bounded_add{
+	constexpr static bound_t lo(bound_t lo1, bound_t, bound_t lo2, bound_t){
+		return saturating_add(lo1, lo2);
+	}
+	constexpr static bound_t hi(bound_t, bound_t hi1, bound_t, bound_t hi2){
+		return saturating_add(hi1, hi2);
+	}
+	constexpr static bool exact(bound_t lo1, bound_t hi1, bound_t lo2, bound_t hi2){
+		return !add_overflows(lo1, lo2) && !add_overflows(hi1, hi2);
+	}
+	template<typename Tpolicy, bool Tchecked, typename T>
+	constexpr static T apply(T lhs, T rhs, T lo, T hi){
+		return (Tchecked && add_overflows(lhs, rhs)) ? (
+				is_negative(rhs) ?
+					Tpolicy::template on_error<std::underflow_error>(lo, lo, "") :
+					Tpolicy::template on_error<std::overflow_error>(hi, hi, "")
+			) : Tchecked ? within_bounds<Tpolicy>(static_cast<T>(lhs + rhs), lo, hi) :
+			static_cast<T>(lhs + rhs);
+	}
+};
+
+struct bounded_sub{
+	constexpr static bound_t lo(bound_t lo1, bound_t, bound_t, bound_t hi2){
+		return saturating_sub(lo1, hi2);
+	}
+	constexpr static bound_t hi(bound_t, bound_t hi1, bound_t lo2, bound_t){
+		return saturating_sub(hi1, lo2);
+	}
+	constexpr static bool exact(bound_t lo1, bound_t hi1, bound_t lo2, bound_t hi2){
+		return !sub_overflows(lo1, hi2) && !sub_overflows(hi1, lo2);
+	}
+	template<typename Tpolicy, bool Tchecked, typename T>
+	constexpr static T apply(T lhs, T rhs, T lo, T hi){
+		return (Tchecked && sub_overflows(lhs, rhs)) ? (
+				is_negative(rhs) ?
+					Tpolicy::template on_error<std::overflow_error>(hi, hi, "") :
+					Tpolicy::template on_error<std::underflow_error>(lo, lo, "")
+			) : Tchecked ? within_bounds<Tpolicy>(static_cast<T>(lhs - rhs), lo, hi) :
+			static_cast<T>(lhs - rhs);
+	}
+};
+
+struct bounded_mul{
+	constexpr static bound_t lo(bound_t lo1, bound_t hi1, bound_t lo2, bound_t hi2){
+		return min_bound(
+			min_bound(saturating_mul(lo1, lo2), saturating_mul(lo1, hi2)),
+			min_bound(saturating_mul(hi1, lo2), saturating_mul(hi1, hi2)));
+	}
+	constexpr static bound_t hi(bound_t lo1, bound_t hi1, bound_t lo2, bound_t hi2){
+		return max_bound(
+			max_bound(saturating_mul(lo1, lo2), saturating_mul(lo1, hi2)),
+			max_bound(saturating_mul(hi1, lo2), saturating_mul(hi1, hi2)));
+	}
+	constexpr static bool exact(bound_t lo1, bound_t hi1, bound_t lo2, bound_t hi2){
+		return !mul_overflows(lo1, lo2) && !mul_overflows(lo1, hi2)
+			&& !mul_overflows(hi1, lo2) && !mul_overflows(hi1, hi2);
+	}
+	template<typename Tpolicy, bool Tchecked, typename T>
+	constexpr static T apply(T lhs, T rhs, T lo, T hi){
+		return (Tchecked && mul_overflows(lhs, rhs)) ?
+			Tpolicy::template on_error<std::overflow_error>(
+				(is_negative(lhs) == is_negative(rhs)) ? hi : lo,
+				(is_negative(lhs) == is_negative(rhs)) ? hi : lo,
+				"overflow in multiplication") :
+			Tchecked ? within_bounds<Tpolicy>(static_cast<T>(lhs * rhs), lo, hi) :
+			static_cast<T>(lhs * rhs);
+	}
+};
+
+// The division considers the negative and the positive part of the divisor separately;
+// if the divisor may be zero, the check for it is the only check that remains.
+struct bounded_div{
+	constexpr static bound_t corner_min(bound_t lo1, bound_t hi1, bound_t lo2, bound_t hi2){
+		return min_bound(
+			min_bound(saturating_div(lo1, lo2), saturating_div(lo1, hi2)),
+			min_bound(saturating_div(hi1, lo2), saturating_div(hi1, hi2)));
+	}
+	constexpr static bound_t corner_max(bound_t lo1, bound_t hi1, bound_t lo2, bound_t hi2){
+		return max_bound(
+			max_bound(saturating_div(lo1, lo2), saturating_div(lo1, hi2)),
+			max_bound(saturating_div(hi1, lo2), saturating_div(hi1, hi2)));
+	}
+	constexpr static bound_t lo(bound_t lo1, bound_t hi1, bound_t lo2, bound_t hi2){
+		return min_bound(
+			lo2 < 0 ? corner_min(lo1, hi1, lo2, min_bound(hi2, -1)) : bound_max<bound_t>(),
+			hi2 > 0 ? corner_min(lo1, hi1, max_bound(lo2, 1), hi2) : bound_max<bound_t>());
+	}
+	constexpr static bound_t hi(bound_t lo1, bound_t hi1, bound_t lo2, bound_t hi2){
+		return max_bound(
+			lo2 < 0 ? corner_max(lo1, hi1, lo2, min_bound(hi2, -1)) : bound_min<bound_t>(),
+			hi2 > 0 ? corner_max(lo1, hi1, max_bound(lo2, 1), hi2) : bound_min<bound_t>());
+	}
+	constexpr static bool exact(bound_t lo1, bound_t, bound_t lo2, bound_t hi2){
+		return !(lo1 == bound_min<bound_t>() && lo2 <= -1 && hi2 >= -1);
+	}
+	constexpr static bool may_be_zero(bound_t lo2, bound_t hi2){
+		return lo2 <= 0 && hi2 >= 0;
+	}
+	template<typename Tpolicy, bool Tchecked, bool Tzero_check, typename T>
+	constexpr static T apply(T lhs, T rhs, T lo, T hi){
+		return (Tzero_check && rhs == 0) ?
+			Tpolicy::template on_error<std::domain_error>(
+				is_negative(lhs) ? lo : (lhs == 0) ? T{0} : hi,
+				is_negative(lhs) ? lo : (lhs == 0) ? T{0} : hi,
+				"integer-division by 0") :
+			(Tchecked && div_overflows(lhs, rhs)) ?
+				Tpolicy::template on_error<std::overflow_error>(hi, hi, "overflow in division") :
+				static_cast<T>(lhs / rhs);
+	}
+};
+
+/**
+ * @brief Selects the smallest integer-type with at least Tbits bits that can hold
+ * all values in [Tlo, Thi]; if none exists, the one with the size of bound_t is
+ * selected.
+ */
+template<bound_t Tlo, bound_t Thi, int Tbits, bool Tsigned,
+	bool Tfits = (Tlo >= bound_min<typename integer_type<Tbits, Tsigned>::type>()
+		&& Thi <= bound_max<typename integer_type<Tbits, Tsigned>::type>())
+		|| Tbits >= static_cast<int>(sizeof(bound_t) * CHAR_BIT)>
+struct fitting_type{
+	typedef typename fitting_type<Tlo, Thi, Tbits * 2, Tsigned>::type type;
+};
+template<bound_t Tlo, bound_t Thi, int Tbits, bool Tsigned>
+struct fitting_type<Tlo, Thi, Tbits, Tsigned, true>{
+	typedef typename integer_type<Tbits, Tsigned>::type type;
+};
+
+/**
+ * @brief Computes the type of the result of an operation on two bounded values.
+ *
+ * The storage is large enough for the operands and the result, so the operands
+ * can be converted without any checks. Since all bounds are bound_t, it is never
+ * wider than bound_t, even if the shared type of the operands is (as for mixed
+ * signed and unsigned 64 bit integers).
+ */
+template<typename Top, typename Tlhs, typename Trhs> struct bounded_result;
+
+template<typename Top, typename Tlhs, Tlhs Tlo1, Tlhs Thi1,
+	typename Trhs, Trhs Tlo2, Trhs Thi2, typename Tpolicy>
+struct bounded_result<Top, bounded<Tlhs, Tlo1, Thi1, Tpolicy>, bounded<Trhs, Tlo2, Thi2, Tpolicy>>{
+	constexpr static bound_t lo = Top::lo(Tlo1, Thi1, Tlo2, Thi2);
+	constexpr static bound_t hi = Top::hi(Tlo1, Thi1, Tlo2, Thi2);
+	constexpr static bound_t storage_lo = min_bound(lo, min_bound(Tlo1, Tlo2));
+	constexpr static bound_t storage_hi = max_bound(hi, max_bound(Thi1, Thi2));
+
+	typedef typename shared_type<Tlhs, Trhs>::type shared;
+	constexpr static int bits = sizeof(shared) < sizeof(bound_t) ?
+		sizeof(shared) * CHAR_BIT : sizeof(bound_t) * CHAR_BIT;
+	typedef typename fitting_type<storage_lo, storage_hi, bits,
+		impl::is_signed<shared>::value || storage_lo < 0>::type storage;
+
+	constexpr static bool checked = !Top::exact(Tlo1, Thi1, Tlo2, Thi2)
+		|| lo < bound_min<storage>() || hi > bound_max<storage>();
+
+	typedef bounded<storage,
+		static_cast<storage>(clamp_bound(lo, bound_min<storage>(), bound_max<storage>())),
+		static_cast<storage>(clamp_bound(hi, bound_min<storage>(), bound_max<storage>())),
+		Tpolicy> type;
+};
+
+template<typename T>
+constexpr T assume_in_range(T value, T lo, T hi){
+	return (below_bound(value, static_cast<bound_t>(lo)) || above_bound(value, static_cast<bound_t>(hi))) ?
+		(TYPE_BUILDER_UNREACHABLE(), value) : value;
+}
+
+} // namespace impl
+
+/**
+ * @brief An integer with bounds that are known at compile-time.
+ *
+ * The result of an arithmetic operation carries the bounds of all its possible
+ * values (e.g. [0,255] + [0,255] results in [0,510]) and is stored in a type that
+ * is large enough to hold all of them, so the operation itself needs no check.
+ * Runtime-checks are only done if the result may not be representable in any
+ * integer-type, if a division by a value that may be zero is done and if a value is
+ * converted into a bounded with a smaller range.
+ *
+ * If a check fails, Tpolicy decides what happens (see safe_int_policies.hpp); since
+ * the bounds are an invariant of the type, wrapping and poisoning policies get the
+ * saturated value for both arguments.
+ */
+template<typename T, T Tlo, T Thi, typename Tpolicy>
+class bounded{
+	static_assert(impl::is_integer<T>::value, "bounded holds only integral types");
+	static_assert(Tlo <= Thi, "the lower bound of bounded must not be larger than the upper bound");
+	static_assert(!impl::below_bound(Tlo, std::numeric_limits<impl::bound_t>::min())
+			&& !impl::above_bound(Thi, std::numeric_limits<impl::bound_t>::max()),
+			"the bounds of bounded must be representable in std::intmax_t");
+	T val;
+
+	friend struct impl::bounded_access;
+
+	struct unchecked_tag{};
+	constexpr bounded(T value, unchecked_tag): val{value}{}
+
+	template<typename Targ>
+	constexpr static T checked_value(const Targ& value){
+		return impl::below_bound(value, Tlo) ?
+			Tpolicy::template on_error<std::out_of_range>(Tlo, Tlo, "") :
+			impl::above_bound(value, Thi) ?
+				Tpolicy::template on_error<std::out_of_range>(Thi, Thi, "") :
+				static_cast<T>(value);
+	}
+
+	public:
+		typedef T base_type;
+		typedef Tpolicy policy_type;
+		constexpr static base_type min = Tlo;
+		constexpr static base_type max = Thi;
+
+		/**
+		 * @brief Checks whether all values of Tother can be converted to this type
+		 * without any check.
+		 */
+		template<typename Tother>
+		constexpr static bool contains(){
+			return !impl::below_bound(Tother::min, Tlo) && !impl::above_bound(Tother::max, Thi);
+		}
+
+		// every value of Targ has to be checked:
+		template<typename Targ,
+			typename = typename std::enable_if<impl::is_integer<Targ>::value>::type>
+		constexpr explicit bounded(const Targ& value): val{checked_value(value)}{}
+
+		template<typename Targ>
+		constexpr explicit bounded(const safe_int<Targ, Tpolicy>& value):
+			val{checked_value(value.get_value())}{}
+
+		constexpr bounded(const bounded&) = default;
+
+		// widening from another bounded with a range that is completely contained:
+		template<typename Targ, Targ Tother_lo, Targ Tother_hi,
+			typename = typename std::enable_if<
+				contains<bounded<Targ, Tother_lo, Tother_hi, Tpolicy>>()>::type>
+		constexpr bounded(const bounded<Targ, Tother_lo, Tother_hi, Tpolicy>& other):
+			val{static_cast<T>(other.get_value())}{}
+
+		// narrowing from another bounded; this is checked:
+		template<typename Targ, Targ Tother_lo, Targ Tother_hi,
+			typename = typename std::enable_if<
+				!contains<bounded<Targ, Tother_lo, Tother_hi, Tpolicy>>()>::type,
+			typename = void>
+		constexpr explicit bounded(const bounded<Targ, Tother_lo, Tother_hi, Tpolicy>& other):
+			val{checked_value(other.get_value())}{}
+
+		bounded& operator=(const bounded&) = default;
+
+		template<typename Tother>
+		bounded& operator+=(const Tother& other){
+			return (*this = bounded{*this + other});
+		}
+
+		template<typename Tother>
+		bounded& operator-=(const Tother& other){
+			return (*this = bounded{*this - other});
+		}
+
+		template<typename Tother>
+		bounded& operator*=(const Tother& other){
+			return (*this = bounded{*this * other});
+		}
+
+		template<typename Tother>
+		bounded& operator/=(const Tother& other){
+			return (*this = bounded{*this / other});
+		}
+
+		bounded& operator++(){
+			if(val == Thi){
+				val = Tpolicy::template on_error<std::overflow_error>(Thi, Thi, "");
+			}
+			else{
+				++val;
+			}
+			return *this;
+		}
+
+		bounded operator++(int){
+			const bounded old{*this};
+			++*this;
+			return old;
+		}
+
+		bounded& operator--(){
+			if(val == Tlo){
+				val = Tpolicy::template on_error<std::underflow_error>(Tlo, Tlo, "");
+			}
+			else{
+				--val;
+			}
+			return *this;
+		}
+
+		bounded operator--(int){
+			const bounded old{*this};
+			--*this;
+			return old;
+		}
+
+		constexpr bounded operator+() const {
+			return *this;
+		}
+
+		constexpr base_type get_value() const {
+			return impl::assume_in_range(val, Tlo, Thi);
+		}
+
+		constexpr operator base_type() const {
+			return get_value();
+		}
+
+		constexpr safe_int<base_type, Tpolicy> to_safe_int() const {
+			return safe_int<base_type, Tpolicy>{get_value()};
+		}
+};
+
+namespace impl{
+
+struct bounded_access{
+	template<typename Tbounded>
+	constexpr static Tbounded make(typename Tbounded::base_type value){
+		return Tbounded{value, typename Tbounded::unchecked_tag{}};
+	}
+};
+
+} // namespace impl
+
+template<typename Tlhs, Tlhs Tlo1, Tlhs Thi1, typename Trhs, Trhs Tlo2, Trhs Thi2, typename Tpolicy>
+constexpr auto operator+(const bounded<Tlhs, Tlo1, Thi1, Tpolicy>& lhs, const bounded<Trhs, Tlo2, Thi2, Tpolicy>& rhs)
+-> typename impl::bounded_result<impl::bounded_add,
+	bounded<Tlhs, Tlo1, Thi1, Tpolicy>, bounded<Trhs, Tlo2, Thi2, Tpolicy>>::type
+{
+	typedef impl::bounded_result<impl::bounded_add,
+		bounded<Tlhs, Tlo1, Thi1, Tpolicy>, bounded<Trhs, Tlo2, Thi2, Tpolicy>> result;
+	typedef typename result::type return_type;
+	typedef typename result::storage storage;
+	return impl::bounded_access::make<return_type>(
+		impl::bounded_add::apply<Tpolicy, result::checked>(
+			static_cast<storage>(lhs.get_value()), static_cast<storage>(rhs.get_value()),
+			return_type::min, return_type::max));
+}
+
+template<typename Tlhs, Tlhs Tlo1, Tlhs Thi1, typename Trhs, Trhs Tlo2, Trhs Thi2, typename Tpolicy>
+constexpr auto operator-(const bounded<Tlhs, Tlo1, Thi1, Tpolicy>& lhs, const bounded<Trhs, Tlo2, Thi2, Tpolicy>& rhs)
+-> typename impl::bounded_result<impl::bounded_sub,
+	bounded<Tlhs, Tlo1, Thi1, Tpolicy>, bounded<Trhs, Tlo2, Thi2, Tpolicy>>::type
+{
+	typedef impl::bounded_result<impl::bounded_sub,
+		bounded<Tlhs, Tlo1, Thi1, Tpolicy>, bounded<Trhs, Tlo2, Thi2, Tpolicy>> result;
+	typedef typename result::type return_type;
+	typedef typename result::storage storage;
+	return impl::bounded_access::make<return_type>(
+		impl::bounded_sub::apply<Tpolicy, result::checked>(
+			static_cast<storage>(lhs.get_value()), static_cast<storage>(rhs.get_value()),
+			return_type::min, return_type::max));
+}
+
+template<typename Tlhs, Tlhs Tlo1, Tlhs Thi1, typename Trhs, Trhs Tlo2, Trhs Thi2, typename Tpolicy>
+constexpr auto operator*(const bounded<Tlhs, Tlo1, Thi1, Tpolicy>& lhs, const bounded<Trhs, Tlo2, Thi2, Tpolicy>& rhs)
+-> typename impl::bounded_result<impl::bounded_mul,
+	bounded<Tlhs, Tlo1, Thi1, Tpolicy>, bounded<Trhs, Tlo2, Thi2, Tpolicy>>::type
+{
+	typedef impl::bounded_result<impl::bounded_mul,
+		bounded<Tlhs, Tlo1, Thi1, Tpolicy>, bounded<Trhs, Tlo2, Thi2, Tpolicy>> result;
+	typedef typename result::type return_type;
+	typedef typename result::storage storage;
+	return impl::bounded_access::make<return_type>(
+		impl::bounded_mul::apply<Tpolicy, result::checked>(
+			static_cast<storage>(lhs.get_value()), static_cast<storage>(rhs.get_value()),
+			return_type::min, return_type::max));
+}
+
+template<typename Tlhs, Tlhs Tlo1, Tlhs Thi1, typename Trhs, Trhs Tlo2, Trhs Thi2, typename Tpolicy>
+constexpr auto operator/(const bounded<Tlhs, Tlo1, Thi1, Tpolicy>& lhs, const bounded<Trhs, Tlo2, Thi2, Tpolicy>& rhs)
+-> typename impl::bounded_result<impl::bounded_div,
+	bounded<Tlhs, Tlo1, Thi1, Tpolicy>, bounded<Trhs, Tlo2, Thi2, Tpolicy>>::type
+{
+	static_assert(Tlo2 != 0 || Thi2 != 0, "division by a bounded that is always zero");
+	typedef impl::bounded_result<impl::bounded_div,
+		bounded<Tlhs, Tlo1, Thi1, Tpolicy>, bounded<Trhs, Tlo2, Thi2, Tpolicy>> result;
+	typedef typename result::type return_type;
+	typedef typename result::storage storage;
+	return impl::bounded_access::make<return_type>(
+		impl::bounded_div::apply<Tpolicy, result::checked, impl::bounded_div::may_be_zero(Tlo2, Thi2)>(
+			static_cast<storage>(lhs.get_value()), static_cast<storage>(rhs.get_value()),
+			return_type::min, return_type::max));
+}
+
+template<typename T, T Tlo, T Thi, typename Tpolicy>
+constexpr auto operator-(const bounded<T, Tlo, Thi, Tpolicy>& value)
+-> decltype(bounded<T, T{0}, T{0}, Tpolicy>{T{0}} - value)
+{
+	return bounded<T, T{0}, T{0}, Tpolicy>{T{0}} - value;
+}
+
+// comparisions are exact, since all values are representable as impl::bound_t:
+
+template<typename Tlhs, Tlhs Tlo1, Tlhs Thi1, typename Trhs, Trhs Tlo2, Trhs Thi2, typename Tpolicy>
+constexpr bool operator==(const bounded<Tlhs, Tlo1, Thi1, Tpolicy>& lhs, const bounded<Trhs, Tlo2, Thi2, Tpolicy>& rhs){
+	return static_cast<impl::bound_t>(lhs.get_value()) == static_cast<impl::bound_t>(rhs.get_value());
+}
+
+template<typename Tlhs, Tlhs Tlo1, Tlhs Thi1, typename Trhs, Trhs Tlo2, Trhs Thi2, typename Tpolicy>
+constexpr bool operator!=(const bounded<Tlhs, Tlo1, Thi1, Tpolicy>& lhs, const bounded<Trhs, Tlo2, Thi2, Tpolicy>& rhs){
+	return static_cast<impl::bound_t>(lhs.get_value()) != static_cast<impl::bound_t>(rhs.get_value());
+}
+
+template<typename Tlhs, Tlhs Tlo1, Tlhs Thi1, typename Trhs, Trhs Tlo2, Trhs Thi2, typename Tpolicy>
+constexpr bool operator<(const bounded<Tlhs, Tlo1, Thi1, Tpolicy>& lhs, const bounded<Trhs, Tlo2, Thi2, Tpolicy>& rhs){
+	return static_cast<impl::bound_t>(lhs.get_value()) < static_cast<impl::bound_t>(rhs.get_value());
+}
+
+template<typename Tlhs, Tlhs Tlo1, Tlhs Thi1, typename Trhs, Trhs Tlo2, Trhs Thi2, typename Tpolicy>
+constexpr bool operator<=(const bounded<Tlhs, Tlo1, Thi1, Tpolicy>& lhs, const bounded<Trhs, Tlo2, Thi2, Tpolicy>& rhs){
+	return static_cast<impl::bound_t>(lhs.get_value()) <= static_cast<impl::bound_t>(rhs.get_value());
+}
+
+template<typename Tlhs, Tlhs Tlo1, Tlhs Thi1, typename Trhs, Trhs Tlo2, Trhs Thi2, typename Tpolicy>
+constexpr bool operator>(const bounded<Tlhs, Tlo1, Thi1, Tpolicy>& lhs, const bounded<Trhs, Tlo2, Thi2, Tpolicy>& rhs){
+	return static_cast<impl::bound_t>(lhs.get_value()) > static_cast<impl::bound_t>(rhs.get_value());
+}
+
+template<typename Tlhs, Tlhs Tlo1, Tlhs Thi1, typename Trhs, Trhs Tlo2, Trhs Thi2, typename Tpolicy>
+constexpr bool operator>=(const bounded<Tlhs, Tlo1, Thi1, Tpolicy>& lhs, const bounded<Trhs, Tlo2, Thi2, Tpolicy>& rhs){
+	return static_cast<impl::bound_t>(lhs.get_value()) >= static_cast<impl::bound_t>(rhs.get_value());
+}
+
+template<typename Tchar, typename T, T Tlo, T Thi, typename Tpolicy>
+std::basic_ostream<Tchar>& operator<<(std::basic_ostream<Tchar>& stream, const bounded<T, Tlo, Thi, Tpolicy>& value){
+	return (stream << value.get_value());
+}
+
+} // namespace type_builder
+
+#endif
@@ -0,0 +1,222 @@
+#ifndef TYPE_BUILDER_DIVISOR_HPP
+#define TYPE_BUILDER_DIVISOR_HPP
+
+#include <climits>
+#include <cstdint>
+#include <type_traits>
+
+namespace type_builder {
+
+namespace impl{
+
+#if defined(__SIZEOF_INT128__)
+// __extension__ keeps -pedantic quiet about the non-standard types:
+__extension__ typedef unsigned __int128 divisor_uint128_t;
+__extension__ typedef __int128 divisor_int128_t;
+#endif
+
+// Types with at least twice the bits of T, that hold the full product of two values
+// of T, or void if there are none:
+template<typename T, typename = void>
+struct double_width{
+	typedef void type;
+};
+
+template<typename T>
+struct double_width<T, typename std::enable_if<std::is_integral<T>::value
+		&& (sizeof(T) <= sizeof(std::uint32_t))>::type>{
+	typedef std::uint64_t type;
+	typedef std::int64_t signed_type;
+};
+
+#if defined(__SIZEOF_INT128__)
+template<typename T>
+struct double_width<T, typename std::enable_if<std::is_integral<T>::value
+		&& sizeof(T) == sizeof(std::uint64_t)>::type>{
+	typedef divisor_uint128_t type;
+	typedef divisor_int128_t signed_type;
+};
+#endif
+
+template<typename T>
+struct has_fast_division: std::integral_constant<bool,
+	!std::is_void<typename double_width<T>::type>::value && !std::is_same<T, bool>::value>{};
+
+template<typename U>
+constexpr unsigned ceil_log2(U value, unsigned bits = 0){
+	return (bits < sizeof(U) * CHAR_BIT && (U(1) << bits) < value) ?
+		ceil_log2(value, bits + 1) : bits;
+}
+
+/**
+ * @brief Divides by an invariant integer with a multiplication and shifts, as in
+ *        "Division by Invariant Integers using Multiplication" by Granlund and
+ *        Montgomery, figures 4.1 and 5.1.
+ *
+ * Like the built-in division the quotient is rounded toward zero.
+ */
+template<typename T, bool Tfast = has_fast_division<T>::value,
+	bool Tsigned = std::is_signed<T>::value>
+class reciprocal{
+	typedef typename std::make_unsigned<T>::type U;
+	typedef typename double_width<T>::type W;
+	static constexpr unsigned bits = sizeof(T) * CHAR_BIT;
+
+	U multiplier;
+	unsigned char pre_shift;
+	unsigned char post_shift;
+
+	static constexpr U high_product(U lhs, U rhs){
+		return U((W(lhs) * W(rhs)) >> bits);
+	}
+
+	static constexpr U multiplier_of(U value, unsigned log){
+		return U(((W(1) << bits) * ((W(1) << log) - value)) / value + 1);
+	}
+
+	public:
+		explicit constexpr reciprocal(T value):
+			multiplier{multiplier_of(value, ceil_log2(U(value)))},
+			pre_shift{static_cast<unsigned char>(ceil_log2(U(value)) > 0 ? 1 : 0)},
+			post_shift{static_cast<unsigned char>(ceil_log2(U(value)) > 0 ? ceil_log2(U(value)) - 1 : 0)}
+		{}
+
+		constexpr T quotient(T dividend) const noexcept{
+			return quotient(dividend, high_product(multiplier, dividend));
+		}
+
+	private:
+		constexpr T quotient(T dividend, U high) const noexcept{
+			return T(U(U(high + U(U(dividend - high) >> pre_shift)) >> post_shift));
+		}
+};
+
+template<typename T>
+class reciprocal<T, true, true>{
+	typedef typename std::make_unsigned<T>::type U;
+	typedef typename double_width<T>::type W;
+	typedef typename double_width<T>::signed_type S;
+	static constexpr unsigned bits = sizeof(T) * CHAR_BIT;
+
+	T multiplier; // m - 2^N of the paper
+	T divisor_sign; // -1 if the divisor is negative, 0 otherwise
+	unsigned char shift;
+
+	static constexpr U magnitude(T value){
+		return value < 0 ? U(U(0) - U(value)) : U(value);
+	}
+
+	static constexpr unsigned log_of(U value){
+		return ceil_log2(value) > 1 ? ceil_log2(value) : 1;
+	}
+
+	public:
+		explicit constexpr reciprocal(T value):
+			multiplier{T(S((W(1) << (bits + log_of(magnitude(value)) - 1))
+				/ magnitude(value) + 1) - (S(1) << bits))},
+			divisor_sign{T(value < 0 ? -1 : 0)},
+			shift{static_cast<unsigned char>(log_of(magnitude(value)) - 1)}
+		{}
+
+		// The intermediate results fit into S, whose right-shift is arithmetic:
+		constexpr T quotient(T dividend) const noexcept{
+			return T(((((S(dividend) + ((S(multiplier) * dividend) >> bits)) >> shift)
+				+ (dividend < 0 ? 1 : 0)) ^ divisor_sign) - divisor_sign);
+		}
+};
+
+// without a type for the full products the division is done normally:
+template<typename T, bool Tsigned>
+class reciprocal<T, false, Tsigned>{
+	T value;
+
+	public:
+		explicit constexpr reciprocal(T value): value{value}{}
+
+		constexpr T quotient(T dividend) const noexcept{
+			return dividend / value;
+		}
+};
+
+}
+
+/**
+ * @brief An integral divisor that is invariant over many divisions, such as a
+ *        bucket-size that is configured at runtime.
+ *
+ * The construction precomputes a reciprocal, so that dividing by it afterwards
+ * costs a multiplication and a few shifts instead of a division. Integers that
+ * don't have an unsigned type of twice their size (64 bit integers without
+ * __int128) are divided normally.
+ *
+ * It is used like the integer itself:
+ *
+ *   const type_builder::divisor<int> buckets{bucket_count};
+ *   int bucket = hash % buckets;
+ *
+ * and works for the integer-division and modulo of basic_number; the specialization
+ * for safe_int is in safe_int_divisor.hpp.
+ *
+ * @param T the integral type, the divisor must not be 0
+ */
+template<typename T>
+class divisor{
+	T value;
+	impl::reciprocal<T> inverse;
+
+	public:
+		typedef T value_type;
+
+		explicit constexpr divisor(T value): value{value}, inverse{value}{}
+
+		constexpr T get_value() const noexcept{
+			return value;
+		}
+
+		constexpr T quotient(T dividend) const noexcept{
+			return inverse.quotient(dividend);
+		}
+
+		constexpr T remainder(T dividend) const noexcept{
+			return T(dividend - quotient(dividend) * value);
+		}
+
+		// The dividend has to be a T: other integers would be converted to it
+		// silently, which truncates wider ones.
+
+		template<typename Tdividend>
+		friend constexpr typename std::enable_if<std::is_same<Tdividend, T>::value, T>::type
+		operator/(Tdividend lhs, const divisor& rhs) noexcept{
+			return rhs.quotient(lhs);
+		}
+
+		template<typename Tdividend>
+		friend constexpr typename std::enable_if<std::is_same<Tdividend, T>::value, T>::type
+		operator%(Tdividend lhs, const divisor& rhs) noexcept{
+			return rhs.remainder(lhs);
+		}
+
+		template<typename Tdividend>
+		friend typename std::enable_if<std::is_same<Tdividend, T>::value, T&>::type
+		operator/=(Tdividend& lhs, const divisor& rhs) noexcept{
+			return lhs = rhs.quotient(lhs);
+		}
+
+		template<typename Tdividend>
+		friend typename std::enable_if<std::is_same<Tdividend, T>::value, T&>::type
+		operator%=(Tdividend& lhs, const divisor& rhs) noexcept{
+			return lhs = rhs.remainder(lhs);
+		}
+};
+
+template<typename T, typename Tpolicy>
+class safe_int;
+
+// Only declared here, so that dividing safe_ints without safe_int_divisor.hpp fails
+// instead of skipping their checks:
+template<typename T, typename Tpolicy>
+class divisor<safe_int<T, Tpolicy>>;
+
+} // namespace type_builder
+
+#endif
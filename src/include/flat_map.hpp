@@ -0,0 +1,329 @@
+#ifndef TYPE_BUILDER_FLAT_MAP_HPP
+#define TYPE_BUILDER_FLAT_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace type_builder {
+
+namespace impl{
+
+// The integer that a key holds, unwrapped through the get_value() of basic_number
+// and safe_int, and the key of an integer:
+template<typename Tkey, typename = void>
+struct flat_map_key{
+	typedef Tkey value_type;
+
+	static constexpr value_type value(const Tkey& key){
+		return key;
+	}
+
+	static constexpr Tkey make(value_type value){
+		return value;
+	}
+};
+
+template<typename Tkey>
+struct flat_map_key<Tkey, decltype(void(std::declval<const Tkey&>().get_value()))>{
+	typedef typename std::decay<decltype(std::declval<const Tkey&>().get_value())>::type inner;
+	typedef typename flat_map_key<inner>::value_type value_type;
+
+	static constexpr value_type value(const Tkey& key){
+		return flat_map_key<inner>::value(key.get_value());
+	}
+
+	static constexpr Tkey make(value_type value){
+		return Tkey(flat_map_key<inner>::make(value));
+	}
+};
+
+} // namespace impl
+
+/**
+ * @brief A hash-map from integral keys, such as basic_numbers of ids, with open
+ *        addressing in a flat array.
+ *
+ * The keys are stored as the integers that they hold, in an array of their own, so
+ * that a lookup mostly touches a single cache-line of keys; the values are in a
+ * second array at the same indices. A key is looked up in its home slot first,
+ * where most keys are, and otherwise in the groups of a cache-line of keys from the
+ * one of the home slot on, that are compared without branches, so that the compiler
+ * can do it in SIMD-lanes. Instead of additional metadata two values of the keys are reserved:
+ * std::numeric_limits<Tkey>::max() marks empty slots and the one below it slots of
+ * erased keys; they cannot be inserted.
+ *
+ * The keys are hashed by a multiplication with the golden ratio, which spreads
+ * consecutive ids as well as ids with a common stride.
+ *
+ * @param Tkey an integral type or a basic_number or safe_int of one
+ * @param Tvalue the default-constructible type of the values; erased values are
+ *        replaced by a default-constructed one
+ */
+template<typename Tkey, typename Tvalue>
+class flat_map{
+	typedef impl::flat_map_key<Tkey> key_traits;
+	typedef typename key_traits::value_type T;
+
+	static_assert(std::is_integral<T>::value, "flat_map needs integral keys");
+
+	static constexpr std::size_t group_size = (64 / sizeof(T) < 8) ? 8 : 64 / sizeof(T);
+	static constexpr std::size_t max_load_numerator = 7;
+	static constexpr std::size_t max_load_denominator = 8;
+
+	static constexpr T empty_key(){
+		return key_traits::value(std::numeric_limits<Tkey>::max());
+	}
+
+	static constexpr T erased_key(){
+		return static_cast<T>(empty_key() - 1);
+	}
+
+	std::vector<T> keys;
+	std::vector<Tvalue> values;
+	std::size_t elements = 0;
+	std::size_t erased = 0;
+
+	static constexpr std::size_t npos = std::size_t(-1);
+
+	// The index of the first slot of the group that holds key, or group_size if
+	// none does. It is the minimum of the indices of the matches instead of the end
+	// of a loop with a branch, so that the compiler compares the whole group in
+	// SIMD-lanes:
+	static std::size_t position(const T* group, T key) noexcept{
+		unsigned result = group_size;
+		for(std::size_t i = 0; i < group_size; ++i){
+			const unsigned index = group[i] == key ? static_cast<unsigned>(i) : unsigned{group_size};
+			result = index < result ? index : result;
+		}
+		return result;
+	}
+
+	std::size_t groups() const noexcept{
+		return keys.size() / group_size;
+	}
+
+	std::size_t home_slot(T key) const noexcept{
+		return static_cast<std::size_t>(
+			(static_cast<std::uint64_t>(key) * UINT64_C(0x9e3779b97f4a7c15)) >> 32) & (keys.size() - 1);
+	}
+
+	std::size_t index_of(T key) const noexcept{
+		if(keys.empty() || key == empty_key() || key == erased_key()){
+			return npos;
+		}
+		const std::size_t home = home_slot(key);
+		if(keys[home] == key){
+			return home;
+		}
+		for(std::size_t group = home / group_size;; group = (group + 1) & (groups() - 1)){
+			const T* slots = keys.data() + group * group_size;
+			const std::size_t found = position(slots, key);
+			if(found != group_size){
+				return group * group_size + found;
+			}
+			// a group with an empty slot has not been full since the last rehash, so
+			// no key has been pushed past it:
+			if(position(slots, empty_key()) != group_size){
+				return npos;
+			}
+		}
+	}
+
+	// the first free slot of the probe-sequence of a key that is not stored:
+	std::size_t free_index_of(T key) const noexcept{
+		const std::size_t home = home_slot(key);
+		if(keys[home] == empty_key() || keys[home] == erased_key()){
+			return home;
+		}
+		for(std::size_t group = home / group_size;; group = (group + 1) & (groups() - 1)){
+			const T* slots = keys.data() + group * group_size;
+			const std::size_t free = std::min(position(slots, empty_key()), position(slots, erased_key()));
+			if(free != group_size){
+				return group * group_size + free;
+			}
+		}
+	}
+
+	void check_key(T key) const{
+		if(key == empty_key() || key == erased_key()){
+			throw std::invalid_argument{"flat_map: the key is reserved"};
+		}
+	}
+
+	// Grows the arrays if they would be fuller than the maximal load afterwards,
+	// or drops the erased slots if they make them so:
+	void prepare_insertion(){
+		if((elements + erased + 1) * max_load_denominator <= keys.size() * max_load_numerator){
+			return;
+		}
+		rehash((elements + 1) * max_load_denominator <= keys.size() * max_load_numerator / 2 ?
+			keys.size() : keys.size() * 2);
+	}
+
+	void rehash(std::size_t slots){
+		if(slots < group_size){
+			slots = group_size;
+		}
+		std::vector<T> old_keys = std::move(keys);
+		std::vector<Tvalue> old_values = std::move(values);
+		keys = std::vector<T>(slots, empty_key());
+		values = std::vector<Tvalue>(slots);
+		erased = 0;
+		for(std::size_t i = 0; i < old_keys.size(); ++i){
+			if(old_keys[i] != empty_key() && old_keys[i] != erased_key()){
+				const std::size_t index = free_index_of(old_keys[i]);
+				keys[index] = old_keys[i];
+				values[index] = std::move(old_values[i]);
+			}
+		}
+	}
+
+	public:
+		typedef Tkey key_type;
+		typedef Tvalue mapped_type;
+		typedef std::size_t size_type;
+
+		flat_map() = default;
+
+		/**
+		 * @brief Creates an empty map that holds count elements without growing.
+		 */
+		explicit flat_map(std::size_t count){
+			reserve(count);
+		}
+
+		std::size_t size() const noexcept{
+			return elements;
+		}
+
+		bool empty() const noexcept{
+			return elements == 0;
+		}
+
+		/**
+		 * @brief The number of slots, of which at most 7/8 are used.
+		 */
+		std::size_t capacity() const noexcept{
+			return keys.size();
+		}
+
+		void reserve(std::size_t count){
+			std::size_t slots = group_size;
+			while(slots * max_load_numerator < count * max_load_denominator){
+				slots *= 2;
+			}
+			if(slots > keys.size()){
+				rehash(slots);
+			}
+		}
+
+		void clear(){
+			keys.assign(keys.size(), empty_key());
+			for(Tvalue& value: values){
+				value = Tvalue{};
+			}
+			elements = 0;
+			erased = 0;
+		}
+
+		/**
+		 * @return the value of key or nullptr if it is not in the map
+		 */
+		Tvalue* find(const Tkey& key) noexcept{
+			const std::size_t index = index_of(key_traits::value(key));
+			return index == npos ? nullptr : values.data() + index;
+		}
+
+		const Tvalue* find(const Tkey& key) const noexcept{
+			const std::size_t index = index_of(key_traits::value(key));
+			return index == npos ? nullptr : values.data() + index;
+		}
+
+		bool contains(const Tkey& key) const noexcept{
+			return index_of(key_traits::value(key)) != npos;
+		}
+
+		/**
+		 * @brief Inserts key with value unless it is already in the map.
+		 * @return the value of key and whether it was inserted
+		 * @throws std::invalid_argument if key is one of the reserved values
+		 */
+		std::pair<Tvalue*, bool> insert(const Tkey& key, Tvalue value){
+			const T raw = key_traits::value(key);
+			check_key(raw);
+			std::size_t index = index_of(raw);
+			if(index != npos){
+				return {values.data() + index, false};
+			}
+			prepare_insertion();
+			index = free_index_of(raw);
+			erased -= (keys[index] == erased_key()) ? 1 : 0;
+			keys[index] = raw;
+			values[index] = std::move(value);
+			++elements;
+			return {values.data() + index, true};
+		}
+
+		/**
+		 * @return the value of key, which is default-constructed and inserted if it
+		 *         is not in the map
+		 * @throws std::invalid_argument if key is one of the reserved values
+		 */
+		Tvalue& operator[](const Tkey& key){
+			Tvalue* value = find(key);
+			return value ? *value : *insert(key, Tvalue{}).first;
+		}
+
+		/**
+		 * @return whether key was in the map
+		 */
+		bool erase(const Tkey& key){
+			const std::size_t index = index_of(key_traits::value(key));
+			if(index == npos){
+				return false;
+			}
+			// the slot becomes empty again if no key can have been pushed past its group:
+			const T* group = keys.data() + index / group_size * group_size;
+			if(position(group, empty_key()) != group_size){
+				keys[index] = empty_key();
+			}
+			else{
+				keys[index] = erased_key();
+				++erased;
+			}
+			values[index] = Tvalue{};
+			--elements;
+			return true;
+		}
+
+		/**
+		 * @brief Calls function(key, value) for every element, in no particular order.
+		 */
+		template<typename Tfunction>
+		void for_each(Tfunction function){
+			for(std::size_t i = 0; i < keys.size(); ++i){
+				if(keys[i] != empty_key() && keys[i] != erased_key()){
+					function(key_traits::make(keys[i]), values[i]);
+				}
+			}
+		}
+
+		template<typename Tfunction>
+		void for_each(Tfunction function) const{
+			for(std::size_t i = 0; i < keys.size(); ++i){
+				if(keys[i] != empty_key() && keys[i] != erased_key()){
+					function(key_traits::make(keys[i]), static_cast<const Tvalue&>(values[i]));
+				}
+			}
+		}
+};
+
+} // namespace type_builder
+
+#endif
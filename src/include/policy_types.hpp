@@ -1,6 +1,15 @@
 #ifndef POLICY_TYPES_HPP
 #define POLICY_TYPES_HPP
 
+// Constants at namespace-scope are inline variables since C++17, which gives them
+// external linkage, so that they can be used by the exported templates of the
+// type_builder module:
+#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
+#	define TYPE_BUILDER_INLINE_VARIABLE inline
+#else
+#	define TYPE_BUILDER_INLINE_VARIABLE
+#endif
+
 namespace type_builder{
 
 /**
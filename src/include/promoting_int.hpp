@@ -0,0 +1,636 @@
+#ifndef TYPE_BUILDER_PROMOTING_INT_HPP
+#define TYPE_BUILDER_PROMOTING_INT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iosfwd>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "safe_int.hpp"
+
+namespace type_builder {
+
+namespace impl{
+
+/**
+ * @brief The value of a promoting_int that doesn't fit into a machine word.
+ *
+ * The magnitude is stored as little-endian 32 bit limbs, so that the product of two
+ * limbs fits into 64 bits, in the same block right behind this header.
+ */
+struct big_value{
+	// the next block in the pool while this one is unused:
+	big_value* next;
+	std::uint32_t capacity;
+	std::uint32_t size;
+	bool negative;
+
+	std::uint32_t* limbs(){
+		return reinterpret_cast<std::uint32_t*>(this + 1);
+	}
+	const std::uint32_t* limbs() const {
+		return reinterpret_cast<const std::uint32_t*>(this + 1);
+	}
+};
+
+// Blocks are cached per thread in lists of capacities that are powers of two, so that
+// values that are promoted and demoted again and again don't go to the allocator.
+// The cache is trivially destructible, so that values that are destroyed after the
+// cleanup of the thread (for example static ones) can still check whether it is
+// closed and release their blocks directly.
+TYPE_BUILDER_INLINE_VARIABLE constexpr std::size_t big_value_classes = 27;
+TYPE_BUILDER_INLINE_VARIABLE constexpr std::uint32_t big_value_max_cached = 64;
+
+struct big_value_cache{
+	big_value* free[big_value_classes];
+	std::uint32_t cached[big_value_classes];
+	bool closed;
+};
+
+inline big_value_cache& local_big_value_cache(){
+	static thread_local big_value_cache cache;
+	return cache;
+}
+
+struct big_value_cache_cleanup{
+	~big_value_cache_cleanup(){
+		big_value_cache& cache = local_big_value_cache();
+		for(std::size_t i = 0; i < big_value_classes; ++i){
+			while(cache.free[i]){
+				big_value* const next = cache.free[i]->next;
+				::operator delete(cache.free[i]);
+				cache.free[i] = next;
+			}
+		}
+		cache.closed = true;
+	}
+};
+
+inline std::size_t big_value_class(std::uint32_t capacity){
+	std::size_t result = 0;
+	while((std::uint32_t{4} << result) < capacity){
+		++result;
+	}
+	return result;
+}
+
+inline big_value* allocate_big_value(std::uint32_t capacity){
+	const std::size_t size_class = big_value_class(capacity);
+	big_value_cache& cache = local_big_value_cache();
+	big_value* result = cache.free[size_class];
+	if(result){
+		cache.free[size_class] = result->next;
+		--cache.cached[size_class];
+	}
+	else{
+		const std::uint32_t limbs = std::uint32_t{4} << size_class;
+		result = new(::operator new(sizeof(big_value) + limbs * sizeof(std::uint32_t))) big_value{};
+		result->capacity = limbs;
+	}
+	result->next = nullptr;
+	result->size = 0;
+	result->negative = false;
+	return result;
+}
+
+inline void release_big_value(big_value* value){
+	const std::size_t size_class = big_value_class(value->capacity);
+	big_value_cache& cache = local_big_value_cache();
+	if(cache.closed || cache.cached[size_class] >= big_value_max_cached){
+		::operator delete(value);
+		return;
+	}
+	// registers the cleanup of the cache at the exit of the thread:
+	static thread_local big_value_cache_cleanup cleanup;
+	(void) cleanup;
+	value->next = cache.free[size_class];
+	cache.free[size_class] = value;
+	++cache.cached[size_class];
+}
+
+/**
+ * @brief A signed magnitude that is either a big_value or the limbs of a small value.
+ */
+class big_view{
+	std::uint32_t small_limbs[2];
+	const std::uint32_t* limb_data;
+
+	public:
+		std::uint32_t size;
+		bool negative;
+
+		// the value of a promoting_int, which is big if big is not null:
+		big_view(std::int64_t small, const big_value* big):
+			small_limbs{}, limb_data{small_limbs}, size{0}, negative{small < 0} {
+			if(big){
+				limb_data = big->limbs();
+				size = big->size;
+				negative = big->negative;
+				return;
+			}
+			const std::uint64_t magnitude = negative ?
+				std::uint64_t{0} - static_cast<std::uint64_t>(small) : static_cast<std::uint64_t>(small);
+			small_limbs[0] = static_cast<std::uint32_t>(magnitude);
+			small_limbs[1] = static_cast<std::uint32_t>(magnitude >> 32);
+			size = small_limbs[1] ? 2 : small_limbs[0] ? 1 : 0;
+		}
+
+		big_view(const big_view&) = delete;
+		big_view& operator=(const big_view&) = delete;
+
+		const std::uint32_t* limbs() const {
+			return limb_data;
+		}
+};
+
+// The algorithms on magnitudes; out must not overlap with the inputs:
+
+inline int compare_magnitudes(const std::uint32_t* lhs, std::uint32_t lhs_size,
+		const std::uint32_t* rhs, std::uint32_t rhs_size){
+	if(lhs_size != rhs_size){
+		return (lhs_size < rhs_size) ? -1 : 1;
+	}
+	for(std::uint32_t i = lhs_size; i-- > 0;){
+		if(lhs[i] != rhs[i]){
+			return (lhs[i] < rhs[i]) ? -1 : 1;
+		}
+	}
+	return 0;
+}
+
+// out needs max(lhs_size, rhs_size) + 1 limbs:
+inline std::uint32_t add_magnitudes(const std::uint32_t* lhs, std::uint32_t lhs_size,
+		const std::uint32_t* rhs, std::uint32_t rhs_size, std::uint32_t* out){
+	if(lhs_size < rhs_size){
+		std::swap(lhs, rhs);
+		std::swap(lhs_size, rhs_size);
+	}
+	std::uint64_t carry = 0;
+	for(std::uint32_t i = 0; i < lhs_size; ++i){
+		carry += std::uint64_t{lhs[i]} + (i < rhs_size ? rhs[i] : 0u);
+		out[i] = static_cast<std::uint32_t>(carry);
+		carry >>= 32;
+	}
+	out[lhs_size] = static_cast<std::uint32_t>(carry);
+	return lhs_size + 1;
+}
+
+// requires |lhs| >= |rhs|; out needs lhs_size limbs:
+inline std::uint32_t sub_magnitudes(const std::uint32_t* lhs, std::uint32_t lhs_size,
+		const std::uint32_t* rhs, std::uint32_t rhs_size, std::uint32_t* out){
+	std::uint32_t borrow = 0;
+	for(std::uint32_t i = 0; i < lhs_size; ++i){
+		const std::uint64_t subtrahend = std::uint64_t{i < rhs_size ? rhs[i] : 0u} + borrow;
+		borrow = (lhs[i] < subtrahend) ? 1 : 0;
+		out[i] = static_cast<std::uint32_t>(lhs[i] - subtrahend);
+	}
+	return lhs_size;
+}
+
+// out needs lhs_size + rhs_size limbs:
+inline std::uint32_t mul_magnitudes(const std::uint32_t* lhs, std::uint32_t lhs_size,
+		const std::uint32_t* rhs, std::uint32_t rhs_size, std::uint32_t* out){
+	std::fill(out, out + lhs_size + rhs_size, 0u);
+	for(std::uint32_t i = 0; i < lhs_size; ++i){
+		std::uint64_t carry = 0;
+		for(std::uint32_t j = 0; j < rhs_size; ++j){
+			carry += std::uint64_t{lhs[i]} * rhs[j] + out[i + j];
+			out[i + j] = static_cast<std::uint32_t>(carry);
+			carry >>= 32;
+		}
+		out[i + rhs_size] = static_cast<std::uint32_t>(carry);
+	}
+	return lhs_size + rhs_size;
+}
+
+// Truncating division; quotient needs lhs_size limbs, remainder rhs_size + 1. Divisors
+// with one limb are divided limb by limb, larger ones bit by bit, which is slow
+// but simple, and division of values that big is rare.
+inline void divide_magnitudes(const std::uint32_t* lhs, std::uint32_t lhs_size,
+		const std::uint32_t* rhs, std::uint32_t rhs_size,
+		std::uint32_t* quotient, std::uint32_t* remainder){
+	std::fill(quotient, quotient + lhs_size, 0u);
+	std::fill(remainder, remainder + rhs_size + 1, 0u);
+	if(rhs_size == 1){
+		std::uint64_t rest = 0;
+		for(std::uint32_t i = lhs_size; i-- > 0;){
+			rest = (rest << 32) | lhs[i];
+			quotient[i] = static_cast<std::uint32_t>(rest / rhs[0]);
+			rest %= rhs[0];
+		}
+		remainder[0] = static_cast<std::uint32_t>(rest);
+		return;
+	}
+	for(std::uint32_t bit = lhs_size * 32; bit-- > 0;){
+		// remainder = 2 * remainder + the next bit:
+		for(std::uint32_t i = rhs_size + 1; i-- > 1;){
+			remainder[i] = (remainder[i] << 1) | (remainder[i - 1] >> 31);
+		}
+		remainder[0] = (remainder[0] << 1) | ((lhs[bit / 32] >> (bit % 32)) & 1u);
+		const std::uint32_t size = remainder[rhs_size] ? rhs_size + 1 : rhs_size;
+		if(compare_magnitudes(remainder, size, rhs, rhs_size) >= 0){
+			sub_magnitudes(remainder, rhs_size + 1, rhs, rhs_size, remainder);
+			quotient[bit / 32] |= std::uint32_t{1} << (bit % 32);
+		}
+	}
+}
+
+inline std::uint32_t trimmed_size(const std::uint32_t* limbs, std::uint32_t size){
+	while(size > 0 && limbs[size - 1] == 0){
+		--size;
+	}
+	return size;
+}
+
+} // namespace impl
+
+/**
+ * @brief An integer that promotes itself to arbitrary precision instead of
+ *        overflowing.
+ *
+ * As long as the value fits into an int64_t, it is stored inline and the operations
+ * are those of safe_int<int64_t>: an overflow-check and a check for promoted
+ * operands, which are both well predictable, and no allocation. If an operation
+ * overflows, its result is computed out of line with arbitrary precision in a
+ * block from a pool per thread; results that fit into a word again are demoted
+ * back. Only the division by zero and conversions into safe_ints that can't hold
+ * the value are errors, which are handled by the policy; for the modulo by zero the
+ * policy gets the dividend itself as a promoting_int, which may be promoted.
+ */
+template<typename Tpolicy = throw_on_error>
+class promoting_int{
+	// the value if big is null:
+	std::int64_t small;
+	impl::big_value* big;
+
+	// The out-of-line operations get and return the fields by value, so that the
+	// operands and the results of the inline ones can stay in registers:
+	struct fields{
+		std::int64_t small;
+		impl::big_value* big;
+	};
+
+	explicit promoting_int(fields value): small{value.small}, big{value.big} {}
+
+	fields get_fields() const {
+		return fields{small, big};
+	}
+
+	// takes ownership of value and demotes it if it fits into a word:
+	static fields normalize(impl::big_value* value){
+		const std::uint32_t size = impl::trimmed_size(value->limbs(), value->size);
+		value->size = size;
+		if(size > 2){
+			return fields{0, value};
+		}
+		const std::uint64_t magnitude = (size == 0) ? 0u : (size == 1) ? value->limbs()[0] :
+			(std::uint64_t{value->limbs()[1]} << 32) | value->limbs()[0];
+		const std::uint64_t limit = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max())
+			+ (value->negative ? 1u : 0u);
+		if(magnitude > limit){
+			return fields{0, value};
+		}
+		const bool negative = value->negative;
+		impl::release_big_value(value);
+		return fields{negative ?
+			static_cast<std::int64_t>(std::uint64_t{0} - magnitude) : static_cast<std::int64_t>(magnitude),
+			nullptr};
+	}
+
+	// the big value of the operands with the signs of lhs and sign * rhs:
+	TYPE_BUILDER_COLD static fields add_big(fields lhs, fields rhs, bool subtract){
+		const impl::big_view l{lhs.small, lhs.big};
+		const impl::big_view r{rhs.small, rhs.big};
+		const bool rhs_negative = (r.negative != subtract) && r.size != 0;
+		impl::big_value* result = impl::allocate_big_value(std::max(l.size, r.size) + 1);
+		if(l.negative == rhs_negative){
+			result->size = impl::add_magnitudes(l.limbs(), l.size, r.limbs(), r.size, result->limbs());
+			result->negative = l.negative;
+		}
+		else if(impl::compare_magnitudes(l.limbs(), l.size, r.limbs(), r.size) >= 0){
+			result->size = impl::sub_magnitudes(l.limbs(), l.size, r.limbs(), r.size, result->limbs());
+			result->negative = l.negative;
+		}
+		else{
+			result->size = impl::sub_magnitudes(r.limbs(), r.size, l.limbs(), l.size, result->limbs());
+			result->negative = rhs_negative;
+		}
+		return normalize(result);
+	}
+
+	TYPE_BUILDER_COLD static fields mul_big(fields lhs, fields rhs){
+		const impl::big_view l{lhs.small, lhs.big};
+		const impl::big_view r{rhs.small, rhs.big};
+		impl::big_value* result = impl::allocate_big_value(l.size + r.size + 1);
+		result->size = impl::mul_magnitudes(l.limbs(), l.size, r.limbs(), r.size, result->limbs());
+		result->negative = l.negative != r.negative;
+		return normalize(result);
+	}
+
+	TYPE_BUILDER_COLD static fields divide_big(fields lhs, fields rhs, bool remainder){
+		const impl::big_view l{lhs.small, lhs.big};
+		const impl::big_view r{rhs.small, rhs.big};
+		impl::big_value* quotient = impl::allocate_big_value(l.size + 1);
+		impl::big_value* rest = impl::allocate_big_value(r.size + 1);
+		impl::divide_magnitudes(l.limbs(), l.size, r.limbs(), r.size, quotient->limbs(), rest->limbs());
+		quotient->size = l.size;
+		quotient->negative = l.negative != r.negative;
+		rest->size = r.size + 1;
+		rest->negative = l.negative;
+		const fields q = normalize(quotient);
+		const fields m = normalize(rest);
+		impl::big_value* const unused = remainder ? q.big : m.big;
+		if(unused){
+			impl::release_big_value(unused);
+		}
+		return remainder ? m : q;
+	}
+
+	TYPE_BUILDER_COLD static promoting_int division_by_zero(const promoting_int& lhs, bool remainder){
+		return remainder ?
+			Tpolicy::template on_error<std::domain_error>(lhs, lhs, "modulo of 0") :
+			promoting_int{Tpolicy::template on_error<std::domain_error>(
+				lhs.is_negative() ? std::numeric_limits<std::int64_t>::min() :
+				(lhs == promoting_int{}) ? std::int64_t{0} : std::numeric_limits<std::int64_t>::max(),
+				std::int64_t{0}, "integer-division by 0")};
+	}
+
+	static int compare(const promoting_int& lhs, const promoting_int& rhs){
+		if(!(lhs.big || rhs.big)){
+			return (lhs.small < rhs.small) ? -1 : (lhs.small > rhs.small) ? 1 : 0;
+		}
+		const impl::big_view l{lhs.small, lhs.big};
+		const impl::big_view r{rhs.small, rhs.big};
+		if(l.negative != r.negative){
+			return l.negative ? -1 : 1;
+		}
+		const int magnitude = impl::compare_magnitudes(l.limbs(), l.size, r.limbs(), r.size);
+		return l.negative ? -magnitude : magnitude;
+	}
+
+	// the lowest bits of the two's complement of the value:
+	template<typename Tunsigned>
+	Tunsigned low_bits() const {
+		if(!big){
+			return static_cast<Tunsigned>(small);
+		}
+		const std::uint32_t count = std::min<std::uint32_t>(big->size, sizeof(Tunsigned) / sizeof(std::uint32_t));
+		Tunsigned result = 0;
+		for(std::uint32_t i = count; i-- > 0;){
+			result = static_cast<Tunsigned>((result << 32) | big->limbs()[i]);
+		}
+		return big->negative ? static_cast<Tunsigned>(Tunsigned{0} - result) : result;
+	}
+
+	template<typename T>
+	bool fits() const {
+		typedef typename std::common_type<std::uint64_t, typename impl::make_unsigned<T>::type>::type wide;
+		const promoting_int low{static_cast<T>(low_bits<wide>())};
+		return !big ? (!impl::below_range<T>(small) && !impl::above_range<T>(small)) : low == *this;
+	}
+
+	public:
+		typedef Tpolicy policy_type;
+
+		promoting_int(): small{0}, big{nullptr} {}
+
+		//non-explicit constructor because we want to have implicit conversions
+		template<typename T, typename = typename std::enable_if<
+			impl::is_integer<T>::value && !std::is_same<T, bool>::value>::type>
+		promoting_int(T value): small{0}, big{nullptr} {
+			if(!impl::below_range<std::int64_t>(value) && !impl::above_range<std::int64_t>(value)){
+				small = static_cast<std::int64_t>(value);
+				return;
+			}
+			typedef typename std::common_type<std::uint64_t, typename impl::make_unsigned<T>::type>::type wide;
+			wide magnitude = impl::is_negative(value) ?
+				static_cast<wide>(wide{0} - static_cast<wide>(value)) : static_cast<wide>(value);
+			big = impl::allocate_big_value(sizeof(wide) / sizeof(std::uint32_t));
+			big->negative = impl::is_negative(value);
+			while(magnitude != 0){
+				big->limbs()[big->size++] = static_cast<std::uint32_t>(magnitude);
+				magnitude = static_cast<wide>(magnitude >> 32);
+			}
+		}
+
+		template<typename T>
+		promoting_int(const safe_int<T, Tpolicy>& value): promoting_int{value.get_value()} {}
+
+		promoting_int(const promoting_int& other): small{other.small}, big{nullptr} {
+			if(other.big){
+				big = impl::allocate_big_value(other.big->size);
+				big->size = other.big->size;
+				big->negative = other.big->negative;
+				std::memcpy(big->limbs(), other.big->limbs(), other.big->size * sizeof(std::uint32_t));
+			}
+		}
+
+		promoting_int(promoting_int&& other) noexcept: small{other.small}, big{other.big} {
+			other.big = nullptr;
+		}
+
+		promoting_int& operator=(const promoting_int& other){
+			if(this != &other){
+				*this = promoting_int{other};
+			}
+			return *this;
+		}
+
+		promoting_int& operator=(promoting_int&& other) noexcept {
+			std::swap(small, other.small);
+			std::swap(big, other.big);
+			return *this;
+		}
+
+		~promoting_int(){
+			if(big){
+				impl::release_big_value(big);
+			}
+		}
+
+		/**
+		 * @brief Returns whether the value is stored inline.
+		 */
+		bool is_small() const {
+			return big == nullptr;
+		}
+
+		bool is_negative() const {
+			return big ? big->negative : small < 0;
+		}
+
+		/**
+		 * @brief Converts the value into a safe_int<T>; if it doesn't fit, the policy
+		 *        gets a std::out_of_range with the lowest bits as wrapped value.
+		 */
+		template<typename T>
+		safe_int<T, Tpolicy> narrow() const {
+			typedef typename std::common_type<std::uint64_t, typename impl::make_unsigned<T>::type>::type wide;
+			return fits<T>() ?
+				safe_int<T, Tpolicy>{static_cast<T>(low_bits<wide>())} :
+				safe_int<T, Tpolicy>{Tpolicy::template on_error<std::out_of_range>(
+					is_negative() ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max(),
+					static_cast<T>(low_bits<wide>()), "promoting_int does not fit")};
+		}
+
+		template<typename T>
+		explicit operator safe_int<T, Tpolicy>() const {
+			return narrow<T>();
+		}
+
+		std::string to_string() const {
+			if(!big){
+				return std::to_string(small);
+			}
+			// divides a copy of the magnitude by 10^9 until it is zero:
+			std::vector<std::uint32_t> magnitude(big->limbs(), big->limbs() + big->size);
+			std::string digits;
+			while(!magnitude.empty()){
+				std::uint64_t rest = 0;
+				for(std::size_t i = magnitude.size(); i-- > 0;){
+					rest = (rest << 32) | magnitude[i];
+					magnitude[i] = static_cast<std::uint32_t>(rest / 1000000000u);
+					rest %= 1000000000u;
+				}
+				while(!magnitude.empty() && magnitude.back() == 0){
+					magnitude.pop_back();
+				}
+				for(int i = 0; i < 9 && (rest != 0 || !magnitude.empty()); ++i){
+					digits.push_back(static_cast<char>('0' + rest % 10));
+					rest /= 10;
+				}
+			}
+			if(big->negative){
+				digits.push_back('-');
+			}
+			std::reverse(digits.begin(), digits.end());
+			return digits;
+		}
+
+		friend promoting_int operator+(const promoting_int& lhs, const promoting_int& rhs){
+			return (!(lhs.big || rhs.big) && !impl::add_overflows(lhs.small, rhs.small)) ?
+				promoting_int{static_cast<std::int64_t>(lhs.small + rhs.small)} :
+				promoting_int{add_big(lhs.get_fields(), rhs.get_fields(), false)};
+		}
+
+		friend promoting_int operator-(const promoting_int& lhs, const promoting_int& rhs){
+			return (!(lhs.big || rhs.big) && !impl::sub_overflows(lhs.small, rhs.small)) ?
+				promoting_int{static_cast<std::int64_t>(lhs.small - rhs.small)} :
+				promoting_int{add_big(lhs.get_fields(), rhs.get_fields(), true)};
+		}
+
+		friend promoting_int operator*(const promoting_int& lhs, const promoting_int& rhs){
+			return (!(lhs.big || rhs.big) && !impl::mul_overflows(lhs.small, rhs.small)) ?
+				promoting_int{static_cast<std::int64_t>(lhs.small * rhs.small)} :
+				promoting_int{mul_big(lhs.get_fields(), rhs.get_fields())};
+		}
+
+		friend promoting_int operator/(const promoting_int& lhs, const promoting_int& rhs){
+			return (rhs.big == nullptr && rhs.small == 0) ? division_by_zero(lhs, false) :
+				(!(lhs.big || rhs.big) && !impl::div_overflows(lhs.small, rhs.small)) ?
+				promoting_int{static_cast<std::int64_t>(lhs.small / rhs.small)} :
+				promoting_int{divide_big(lhs.get_fields(), rhs.get_fields(), false)};
+		}
+
+		friend promoting_int operator%(const promoting_int& lhs, const promoting_int& rhs){
+			return (rhs.big == nullptr && rhs.small == 0) ? division_by_zero(lhs, true) :
+				(!(lhs.big || rhs.big) && !impl::div_overflows(lhs.small, rhs.small)) ?
+				promoting_int{static_cast<std::int64_t>(lhs.small % rhs.small)} :
+				promoting_int{divide_big(lhs.get_fields(), rhs.get_fields(), true)};
+		}
+
+		promoting_int operator-() const {
+			return promoting_int{} - *this;
+		}
+
+		promoting_int operator+() const {
+			return *this;
+		}
+
+		promoting_int& operator+=(const promoting_int& other){
+			if(!(big || other.big) && !impl::add_overflows(small, other.small)){
+				small = static_cast<std::int64_t>(small + other.small);
+				return *this;
+			}
+			return (*this = promoting_int{add_big(get_fields(), other.get_fields(), false)});
+		}
+
+		promoting_int& operator-=(const promoting_int& other){
+			if(!(big || other.big) && !impl::sub_overflows(small, other.small)){
+				small = static_cast<std::int64_t>(small - other.small);
+				return *this;
+			}
+			return (*this = promoting_int{add_big(get_fields(), other.get_fields(), true)});
+		}
+
+		promoting_int& operator*=(const promoting_int& other){
+			if(!(big || other.big) && !impl::mul_overflows(small, other.small)){
+				small = static_cast<std::int64_t>(small * other.small);
+				return *this;
+			}
+			return (*this = promoting_int{mul_big(get_fields(), other.get_fields())});
+		}
+
+		promoting_int& operator/=(const promoting_int& other){
+			return (*this = *this / other);
+		}
+
+		promoting_int& operator%=(const promoting_int& other){
+			return (*this = *this % other);
+		}
+
+		promoting_int& operator++(){
+			return (*this += promoting_int{1});
+		}
+
+		promoting_int operator++(int){
+			promoting_int old{*this};
+			++*this;
+			return old;
+		}
+
+		promoting_int& operator--(){
+			return (*this -= promoting_int{1});
+		}
+
+		promoting_int operator--(int){
+			promoting_int old{*this};
+			--*this;
+			return old;
+		}
+
+		friend bool operator==(const promoting_int& lhs, const promoting_int& rhs){
+			return compare(lhs, rhs) == 0;
+		}
+		friend bool operator!=(const promoting_int& lhs, const promoting_int& rhs){
+			return compare(lhs, rhs) != 0;
+		}
+		friend bool operator<(const promoting_int& lhs, const promoting_int& rhs){
+			return compare(lhs, rhs) < 0;
+		}
+		friend bool operator<=(const promoting_int& lhs, const promoting_int& rhs){
+			return compare(lhs, rhs) <= 0;
+		}
+		friend bool operator>(const promoting_int& lhs, const promoting_int& rhs){
+			return compare(lhs, rhs) > 0;
+		}
+		friend bool operator>=(const promoting_int& lhs, const promoting_int& rhs){
+			return compare(lhs, rhs) >= 0;
+		}
+};
+
+template<typename Tchar, typename Tpolicy>
+std::basic_ostream<Tchar>& operator<<(std::basic_ostream<Tchar>& stream, const promoting_int<Tpolicy>& value){
+	return (stream << value.to_string().c_str());
+}
+
+} // namespace type_builder
+
+#endif
@@ -0,0 +1,304 @@
+#ifndef TYPE_BUILDER_SAFE_ACCUMULATOR_HPP
+#define TYPE_BUILDER_SAFE_ACCUMULATOR_HPP
+
+#include <cstddef>
+#include <climits>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "safe_int.hpp"
+#include "span.hpp"
+
+namespace type_builder {
+
+namespace impl{
+
+/**
+ * @brief The register that sums up values of type Tterm.
+ *
+ * If there is an integer-type with twice as many bits as Tterm, it is used and
+ * budget is the number of terms that can be added to it without any possibility
+ * of an overflow (2^bits - 1, which leaves one bit of headroom). Otherwise the
+ * register is Tterm itself and every addition has to be checked.
+ */
+template<typename Tterm,
+	bool Twide = has_integer_type<2 * CHAR_BIT * sizeof(Tterm), impl::is_signed<Tterm>::value>::value>
+struct accumulation_register{
+	typedef typename integer_type<2 * CHAR_BIT * sizeof(Tterm), impl::is_signed<Tterm>::value>::type type;
+	constexpr static std::size_t budget =
+		(CHAR_BIT * sizeof(Tterm) >= CHAR_BIT * sizeof(std::size_t)) ?
+			std::numeric_limits<std::size_t>::max() :
+			(std::size_t{1} << (CHAR_BIT * sizeof(Tterm) % (CHAR_BIT * sizeof(std::size_t)))) - 1;
+};
+
+template<typename Tterm>
+struct accumulation_register<Tterm, false>{
+	typedef Tterm type;
+	constexpr static std::size_t budget = 0;
+};
+
+/**
+ * @brief The exact product of two Ts; if there is no type that can hold it, T
+ *        itself is used and the multiplications are checked.
+ */
+template<typename T,
+	bool Twide = has_integer_type<2 * CHAR_BIT * sizeof(T), impl::is_signed<T>::value>::value>
+struct product_type{
+	typedef typename integer_type<2 * CHAR_BIT * sizeof(T), impl::is_signed<T>::value>::type type;
+	constexpr static bool exact = true;
+};
+
+template<typename T>
+struct product_type<T, false>{
+	typedef T type;
+	constexpr static bool exact = false;
+};
+
+/**
+ * @brief Sums terms of type Tterm and checks only when the register could overflow.
+ */
+template<typename Tterm, typename Tpolicy>
+class deferred_sum{
+	public:
+		typedef typename accumulation_register<Tterm>::type register_type;
+
+	private:
+		register_type sum;
+		std::size_t budget;
+
+		TYPE_BUILDER_COLD void add_checked(register_type value){
+			sum = add_overflows(sum, value) ?
+				Tpolicy::template on_error<std::overflow_error>(
+					is_negative(value) ? std::numeric_limits<register_type>::min() :
+						std::numeric_limits<register_type>::max(),
+					wrapping_add(sum, value), "overflow in accumulation") :
+				static_cast<register_type>(sum + value);
+		}
+
+	public:
+		deferred_sum(): sum{0}, budget{accumulation_register<Tterm>::budget} {}
+
+		void add(Tterm term){
+			if(budget == 0){
+				add_checked(static_cast<register_type>(term));
+				return;
+			}
+			--budget;
+			sum = static_cast<register_type>(sum + static_cast<register_type>(term));
+		}
+
+		/**
+		 * @brief Adds term(i) for all i in [0, count).
+		 *
+		 * The terms are added in chunks that fit into the budget without any check,
+		 * so that the compiler can vectorize them.
+		 */
+		template<typename Tfunction>
+		void add(Tfunction term, std::size_t count){
+			std::size_t i = 0;
+			while(i < count){
+				const std::size_t chunk = (count - i < budget) ? count - i : budget;
+				register_type chunk_sum = 0;
+				for(std::size_t j = i; j < i + chunk; ++j){
+					chunk_sum = static_cast<register_type>(chunk_sum + static_cast<register_type>(term(j)));
+				}
+				sum = static_cast<register_type>(sum + chunk_sum);
+				budget -= chunk;
+				i += chunk;
+				if(budget == 0){
+					for(; i < count; ++i){
+						add_checked(static_cast<register_type>(term(i)));
+					}
+				}
+			}
+		}
+
+		void merge(const deferred_sum& other){
+			// both registers together have used up the budget of both:
+			const std::size_t used = accumulation_register<Tterm>::budget - other.budget;
+			budget = (budget >= used) ? budget - used : 0;
+			if(budget == 0){
+				add_checked(other.sum);
+			}
+			else{
+				sum = static_cast<register_type>(sum + other.sum);
+			}
+		}
+
+		register_type value() const {
+			return sum;
+		}
+
+		template<typename T>
+		safe_int<T, Tpolicy> result() const {
+			return safe_int<T, Tpolicy>{
+				above_range<T>(sum) ?
+					Tpolicy::template on_error<std::overflow_error>(
+						std::numeric_limits<T>::max(), static_cast<T>(sum), "overflow in sum") :
+				below_range<T>(sum) ?
+					Tpolicy::template on_error<std::underflow_error>(
+						std::numeric_limits<T>::min(), static_cast<T>(sum), "underflow in sum") :
+					static_cast<T>(sum)
+			};
+		}
+};
+
+} // namespace impl
+
+/**
+ * @brief Sums safe_ints in a wider register and checks only the final result.
+ *
+ * The values are added to an integer with twice as many bits, which cannot
+ * overflow until 2^bits values have been added; only after that the additions
+ * are checked. The sum is checked when it is converted back into a safe_int<T>.
+ * Only the exact sum has to fit into T: unlike a sequence of safe_int-additions,
+ * intermediate sums that leave the range of T are no error.
+ * If there is no wider type, every addition is checked.
+ */
+template<typename T, typename Tpolicy = throw_on_error>
+class safe_accumulator{
+	impl::deferred_sum<T, Tpolicy> sum;
+
+	public:
+		typedef T base_type;
+		typedef Tpolicy policy_type;
+		typedef typename impl::deferred_sum<T, Tpolicy>::register_type register_type;
+
+		safe_accumulator& operator+=(const safe_int<T, Tpolicy>& value){
+			sum.add(value.get_value());
+			return *this;
+		}
+
+		safe_accumulator& operator+=(span<const safe_int<T, Tpolicy>> values){
+			const safe_int<T, Tpolicy>* data = values.data();
+			sum.add([data](std::size_t i){ return data[i].get_value(); }, values.size());
+			return *this;
+		}
+
+		/**
+		 * @brief Adds the sum of another accumulator.
+		 */
+		safe_accumulator& operator+=(const safe_accumulator& other){
+			sum.merge(other.sum);
+			return *this;
+		}
+
+		/**
+		 * @brief Returns the sum; this is checked.
+		 */
+		safe_int<T, Tpolicy> get() const {
+			return sum.template result<T>();
+		}
+
+		explicit operator safe_int<T, Tpolicy>() const {
+			return get();
+		}
+
+		/**
+		 * @brief Returns the unchecked value of the register.
+		 */
+		register_type get_register() const {
+			return sum.value();
+		}
+};
+
+/**
+ * @brief Sums products of safe_ints in a wider register and checks only the final
+ *        result.
+ *
+ * The products are computed exactly in an integer with twice as many bits and
+ * summed like in safe_accumulator. If there is no type that can hold the exact
+ * product, the multiplications are checked; if there is none that can hold the
+ * sum of the products, the additions are.
+ */
+template<typename T, typename Tpolicy = throw_on_error>
+class safe_dot_accumulator{
+	typedef typename impl::product_type<T>::type product_type;
+	impl::deferred_sum<product_type, Tpolicy> sum;
+
+	constexpr static product_type multiply(T lhs, T rhs){
+		return impl::product_type<T>::exact ?
+			static_cast<product_type>(static_cast<product_type>(lhs) * static_cast<product_type>(rhs)) :
+			static_cast<product_type>((safe_int<T, Tpolicy>{lhs} * safe_int<T, Tpolicy>{rhs}).get_value());
+	}
+
+	public:
+		typedef T base_type;
+		typedef Tpolicy policy_type;
+		typedef typename impl::deferred_sum<product_type, Tpolicy>::register_type register_type;
+
+		/**
+		 * @brief Adds lhs * rhs.
+		 */
+		void add(const safe_int<T, Tpolicy>& lhs, const safe_int<T, Tpolicy>& rhs){
+			sum.add(multiply(lhs.get_value(), rhs.get_value()));
+		}
+
+		/**
+		 * @brief Adds lhs[i] * rhs[i] for all i.
+		 * @throws std::length_error if the sizes of the spans differ
+		 */
+		void add(span<const safe_int<T, Tpolicy>> lhs, span<const safe_int<T, Tpolicy>> rhs){
+			if(lhs.size() != rhs.size()){
+				throw std::length_error{"spans of dot-product differ in size"};
+			}
+			const safe_int<T, Tpolicy>* l = lhs.data();
+			const safe_int<T, Tpolicy>* r = rhs.data();
+			sum.add([l, r](std::size_t i){ return multiply(l[i].get_value(), r[i].get_value()); },
+				lhs.size());
+		}
+
+		safe_dot_accumulator& operator+=(const safe_dot_accumulator& other){
+			sum.merge(other.sum);
+			return *this;
+		}
+
+		/**
+		 * @brief Returns the sum of the products; this is checked.
+		 */
+		safe_int<T, Tpolicy> get() const {
+			return sum.template result<T>();
+		}
+
+		explicit operator safe_int<T, Tpolicy>() const {
+			return get();
+		}
+
+		register_type get_register() const {
+			return sum.value();
+		}
+};
+
+/**
+ * @brief Returns the sum of the safe_ints in values, checking only the final result.
+ * @see safe_accumulator
+ */
+template<typename Tcontainer>
+auto checked_sum(const Tcontainer& values)
+-> safe_int<typename Tcontainer::value_type::base_type, typename Tcontainer::value_type::policy_type>
+{
+	typedef typename Tcontainer::value_type value_type;
+	safe_accumulator<typename value_type::base_type, typename value_type::policy_type> sum;
+	sum += span<const value_type>{values};
+	return sum.get();
+}
+
+/**
+ * @brief Returns the sum of lhs[i] * rhs[i], checking only the final result.
+ * @see safe_dot_accumulator
+ * @throws std::length_error if the sizes of lhs and rhs differ
+ */
+template<typename Tlhs, typename Trhs>
+auto checked_dot(const Tlhs& lhs, const Trhs& rhs)
+-> safe_int<typename Tlhs::value_type::base_type, typename Tlhs::value_type::policy_type>
+{
+	typedef typename Tlhs::value_type value_type;
+	safe_dot_accumulator<typename value_type::base_type, typename value_type::policy_type> sum;
+	sum.add(span<const value_type>{lhs}, span<const value_type>{rhs});
+	return sum.get();
+}
+
+} // namespace type_builder
+
+#endif
@@ -5,25 +5,119 @@
 #include <cstdint>
 #include <limits>
 #include <climits>
+#include <cstddef>
 #include <stdexcept>
 #include <iosfwd>
 
+#include "safe_int_policies.hpp"
+
+#if defined(__SIZEOF_INT128__)
+#	define TYPE_BUILDER_HAS_INT128
+#endif
+
 namespace type_builder {
 
-template<typename T> class safe_int;
-template<typename Tlhs, typename Trhs>
-bool operator<(const safe_int<Tlhs>& lhs, const safe_int<Trhs>& rhs);
-template<typename Tlhs, typename Trhs>
-bool operator>(const safe_int<Tlhs>& lhs, const safe_int<Trhs>& rhs);
+#if defined(TYPE_BUILDER_HAS_INT128)
+// __extension__ keeps -pedantic quiet about the non-standard types:
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+namespace impl{
+	// In strict ISO-mode the standard-library doesn't treat the 128 bit integers
+	// as integral types, so these traits are used instead of the ones from
+	// <type_traits>:
+	template<typename T> struct is_integer: std::is_integral<T> {};
+	template<typename T> struct is_signed: std::is_signed<T> {};
+	template<typename T> struct make_unsigned: std::make_unsigned<T> {};
+#if defined(TYPE_BUILDER_HAS_INT128)
+	template<> struct is_integer<int128_t>: std::true_type {};
+	template<> struct is_integer<uint128_t>: std::true_type {};
+	template<> struct is_signed<int128_t>: std::true_type {};
+	template<> struct is_signed<uint128_t>: std::false_type {};
+	template<> struct make_unsigned<int128_t>{ typedef uint128_t type; };
+	template<> struct make_unsigned<uint128_t>{ typedef uint128_t type; };
+#endif
+
+	// The members of std::numeric_limits of an integer; the standard-library may
+	// not specialize it for the 128 bit integers in strict ISO-mode:
+	template<typename T, bool = std::numeric_limits<T>::is_specialized>
+	struct integer_limits: std::numeric_limits<T> {};
+
+	template<typename T>
+	struct integer_limits<T, false>{
+		static constexpr bool is_specialized = impl::is_integer<T>::value;
+		static constexpr bool is_signed = impl::is_signed<T>::value;
+		static constexpr bool is_integer = true;
+		static constexpr bool is_exact = true;
+		static constexpr bool has_infinity = false;
+		static constexpr bool has_quiet_NaN = false;
+		static constexpr bool has_signaling_NaN = false;
+		static constexpr std::float_denorm_style has_denorm = std::denorm_absent;
+		static constexpr bool has_denorm_loss = false;
+		static constexpr std::float_round_style round_style = std::round_toward_zero;
+		static constexpr bool is_iec559 = false;
+		static constexpr bool is_bounded = true;
+		static constexpr bool is_modulo = !is_signed;
+		static constexpr int digits = static_cast<int>(sizeof(T) * CHAR_BIT) - (is_signed ? 1 : 0);
+		static constexpr int digits10 = digits * 30103 / 100000;
+		static constexpr int max_digits10 = 0;
+		static constexpr int radix = 2;
+		static constexpr int min_exponent = 0;
+		static constexpr int min_exponent10 = 0;
+		static constexpr int max_exponent = 0;
+		static constexpr int max_exponent10 = 0;
+		static constexpr bool traps = false;
+		static constexpr bool tinyness_before = false;
+
+		static constexpr T max() noexcept{
+			return static_cast<T>(~typename make_unsigned<T>::type{0} >> (is_signed ? 1 : 0));
+		}
+		static constexpr T min() noexcept{
+			return is_signed ? static_cast<T>(-max() - 1) : T{0};
+		}
+		static constexpr T lowest() noexcept{
+			return min();
+		}
+		static constexpr T epsilon() noexcept{
+			return T{0};
+		}
+		static constexpr T round_error() noexcept{
+			return T{0};
+		}
+		static constexpr T infinity() noexcept{
+			return T{0};
+		}
+		static constexpr T quiet_NaN() noexcept{
+			return T{0};
+		}
+		static constexpr T signaling_NaN() noexcept{
+			return T{0};
+		}
+		static constexpr T denorm_min() noexcept{
+			return T{0};
+		}
+	};
+}
+
+template<typename T, typename Tpolicy = throw_on_error> class safe_int;
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+bool operator<(const safe_int<Tlhs, Tpolicy>& lhs, const safe_int<Trhs, Tpolicy>& rhs);
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+bool operator>(const safe_int<Tlhs, Tpolicy>& lhs, const safe_int<Trhs, Tpolicy>& rhs);
 
 namespace impl{
 	template<int Tsize, bool Tsigned> struct integer_type;
 	template<typename Tlhs, typename Trhs> 
 		struct shared_type; 
-	template<typename Ttarget_type, typename Tsource_type>
+	template<typename Ttarget_type, typename Tpolicy = throw_on_error, typename Tsource_type>
 		constexpr Ttarget_type checked_cast(const Tsource_type& src);
 	template<typename Tsigned, typename Tunsigned>
 		constexpr bool in_range(const Tunsigned& value);
+	template<typename Ttarget, typename Tsource>
+		constexpr bool below_range(const Tsource& value);
+	template<typename Ttarget, typename Tsource>
+		constexpr bool above_range(const Tsource& value);
 	
 	template<typename T, bool T_is_signed> struct sign_dependent_checks{
 		constexpr static bool is_negative(const T& arg){
@@ -35,18 +129,40 @@ namespace impl{
 			return false;
 		}
 	};
+	
+	template<typename T>
+		constexpr bool add_overflows(T lhs, T rhs);
+	template<typename T>
+		constexpr bool sub_overflows(T lhs, T rhs);
+	template<typename T>
+		constexpr bool mul_overflows(T lhs, T rhs);
+	template<typename T>
+		constexpr bool div_overflows(T lhs, T rhs);
+	template<typename T>
+		constexpr T wrapping_add(T lhs, T rhs);
+	template<typename T>
+		constexpr T wrapping_sub(T lhs, T rhs);
+	template<typename T>
+		constexpr T wrapping_mul(T lhs, T rhs);
 }
 
-template<typename T>
+/**
+ * @brief An integer that checks all operations for errors.
+ * @param T the underlying integral type
+ * @param Tpolicy the policy that decides what happens if an operation fails (see 
+ *        safe_int_policies.hpp); the default is to throw an exception.
+ */
+template<typename T, typename Tpolicy>
 class safe_int{
-	static_assert(std::is_integral<T>::value, "safe_int holds only integral types");
+	static_assert(impl::is_integer<T>::value, "safe_int holds only integral types");
 	T val;
 	
 	public:
 		typedef T base_type;
-		constexpr static bool is_signed = std::is_signed<T>::value;
-		constexpr static base_type max = std::numeric_limits<T>::max();
-		constexpr static base_type min = std::numeric_limits<T>::min();
+		typedef Tpolicy policy_type;
+		constexpr static bool is_signed = impl::is_signed<T>::value;
+		constexpr static base_type max = impl::integer_limits<T>::max();
+		constexpr static base_type min = impl::integer_limits<T>::min();
 		constexpr static base_type default_value = static_cast<T>(0);
 		constexpr static int bits = sizeof(T) * CHAR_BIT;
 		
@@ -65,10 +181,20 @@ class safe_int{
 		}
 		
 		template<typename Trhs>
-		constexpr static bool shift_check(base_type lhs, Trhs rhs){
-			return (is_negative(rhs) || rhs>= bits || is_negative(lhs))
-				? throw std::domain_error{""}
-				: true;
+		constexpr static bool shift_valid(base_type lhs, Trhs rhs){
+			return !(impl::sign_dependent_checks<Trhs, impl::is_signed<Trhs>::value>::is_negative(rhs)
+				|| rhs >= bits || is_negative(lhs));
+		}
+		
+		constexpr static base_type shift_error(){
+			return Tpolicy::template on_error<std::domain_error>(
+					default_value, default_value, "invalid shift");
+		}
+		
+		constexpr static base_type range_error(bool overflow, base_type wrapped){
+			return overflow ?
+				Tpolicy::template on_error<std::overflow_error>(max, wrapped, "") :
+				Tpolicy::template on_error<std::underflow_error>(min, wrapped, "");
 		}
 		
 	public:
@@ -78,19 +204,19 @@ class safe_int{
 		//non-explicit constructor because we want to have implicit conversions
 		constexpr safe_int(T val): val{val}{}
 		
-		constexpr safe_int(const safe_int& other): val{other.val}{}
+		constexpr safe_int(const safe_int&) = default;
 		
-		template<typename Targ>
+		template<typename Targ,
+			typename = typename std::enable_if<impl::is_integer<Targ>::value>::type>
 		constexpr safe_int(const Targ& arg) : val{
-			((safe_int<Targ>{arg} < safe_int{min}) 
-			 || (safe_int<Targ>{arg} > safe_int{max}))?
-				throw std::out_of_range{""} :
+			impl::below_range<T>(arg) ?
+				Tpolicy::template on_error<std::out_of_range>(min, static_cast<base_type>(arg), "") :
+			impl::above_range<T>(arg) ?
+				Tpolicy::template on_error<std::out_of_range>(max, static_cast<base_type>(arg), "") :
 				static_cast<base_type>(arg)
 		}{}
 		
-		safe_int& operator=(const safe_int& other){
-			return (val = other.val), *this;
-		}
+		safe_int& operator=(const safe_int&) = default;
 		
 		friend constexpr bool operator==(const safe_int& lhs, const safe_int& rhs){
 			return lhs.val == rhs.val;
@@ -112,51 +238,63 @@ class safe_int{
 		}
 		
 		friend constexpr safe_int operator+(const safe_int& lhs, const safe_int& rhs){
-			return (is_positive(rhs.val)&&(lhs.val > max - rhs.val)) ?
-				throw std::overflow_error{""} :
-				(lhs.val < min - rhs.val) ?
-					throw std::underflow_error{""} :
-					safe_int{ lhs.val + rhs.val };
+			return impl::add_overflows(lhs.val, rhs.val) ?
+				safe_int{ range_error(is_positive(rhs.val), impl::wrapping_add(lhs.val, rhs.val)) } :
+				safe_int{ static_cast<base_type>(lhs.val + rhs.val) };
 		}
 			
 		friend constexpr safe_int operator-(const safe_int& lhs, const safe_int& rhs){
-			return (is_negative(rhs.val)&&(lhs.val > max + rhs.val)) ?
-				throw std::overflow_error{""} :
-				(lhs.val < min + rhs.val) ?
-					throw std::underflow_error{""} :
-					safe_int{ lhs.val - rhs.val };
+			return impl::sub_overflows(lhs.val, rhs.val) ?
+				safe_int{ range_error(is_negative(rhs.val), impl::wrapping_sub(lhs.val, rhs.val)) } :
+				safe_int{ static_cast<base_type>(lhs.val - rhs.val) };
 		}
 			
 		friend constexpr safe_int operator*(const safe_int& lhs, const safe_int& rhs){
-			return (is_negative(rhs.val) ?
-					(is_negative(lhs.val) ?
-						(lhs.val < max/rhs.val) :
-						(min/rhs.val < lhs.val)) :
-					(is_negative(lhs.val) ?
-						(min/lhs.val < rhs.val) :
-						(max/rhs.val < lhs.val))
-				) ? throw std::overflow_error{"overflow in multiplication"} :
-				safe_int{lhs.val * rhs.val};
+			return impl::mul_overflows(lhs.val, rhs.val) ?
+				safe_int{ Tpolicy::template on_error<std::overflow_error>(
+					(is_negative(lhs.val) == is_negative(rhs.val)) ? max : min,
+					impl::wrapping_mul(lhs.val, rhs.val), "overflow in multiplication") } :
+				safe_int{ static_cast<base_type>(lhs.val * rhs.val) };
 		}
 			
 		friend constexpr safe_int operator/(const safe_int& lhs, const safe_int& rhs){
-			return (rhs.val == 0)?
-				throw std::domain_error{"integer-division by 0"}
-				: safe_int{lhs.val / rhs.val};
+			return (rhs.val == 0) ?
+				safe_int{ Tpolicy::template on_error<std::domain_error>(
+					is_negative(lhs.val) ? min : (lhs.val == 0) ? default_value : max,
+					default_value, "integer-division by 0") } :
+				impl::div_overflows(lhs.val, rhs.val) ?
+					safe_int{ Tpolicy::template on_error<std::overflow_error>(
+						max, min, "overflow in division") } :
+					safe_int{ static_cast<base_type>(lhs.val / rhs.val) };
 		}
 			
 		friend constexpr safe_int operator%(const safe_int& lhs, const safe_int& rhs){
-			return (rhs.val == 0)?
-				throw std::domain_error{"modulo of 0"}
-				: safe_int{lhs.val % rhs.val};
+			return (rhs.val == 0) ?
+				safe_int{ Tpolicy::template on_error<std::domain_error>(
+					lhs.val, lhs.val, "modulo of 0") } :
+				impl::div_overflows(lhs.val, rhs.val) ?
+					safe_int{ default_value } :
+					safe_int{ static_cast<base_type>(lhs.val % rhs.val) };
 		}
 		
 		safe_int& operator+=(const safe_int& other){
-			return (*this = *this + other);
+			if(impl::add_overflows(val, other.val)){
+				val = range_error(is_positive(other.val), impl::wrapping_add(val, other.val));
+			}
+			else{
+				val = static_cast<base_type>(val + other.val);
+			}
+			return *this;
 		}
 		
 		safe_int& operator-=(const safe_int& other){
-			return (*this = *this - other);
+			if(impl::sub_overflows(val, other.val)){
+				val = range_error(is_negative(other.val), impl::wrapping_sub(val, other.val));
+			}
+			else{
+				val = static_cast<base_type>(val - other.val);
+			}
+			return *this;
 		}
 		
 		safe_int& operator*=(const safe_int& other){
@@ -168,45 +306,49 @@ class safe_int{
 		}
 		
 		safe_int& operator%=(const safe_int& other){
-			return (*this = *this & other);
+			return (*this = *this % other);
 		}
 		
 		safe_int& operator++(){
 			if(val == max){
-				throw std::overflow_error{""};
+				val = Tpolicy::template on_error<std::overflow_error>(max, min, "");
+			}
+			else{
+				++val;
 			}
-			++val;
 			return *this;
 		}
 		
 		safe_int operator++(int){
-			if(val == max){
-				throw std::overflow_error{""};
-			}
-			return safe_int{val++};
+			const safe_int old{*this};
+			++*this;
+			return old;
 		}
 		
 		safe_int& operator--(){
 			if(val == min){
-				throw std::underflow_error{""};
+				val = Tpolicy::template on_error<std::underflow_error>(min, max, "");
+			}
+			else{
+				--val;
 			}
-			--val;
 			return *this;
 		}
 		
 		safe_int operator--(int){
-			if(val == min){
-				throw std::underflow_error{""};
-			}
-			return safe_int{val--};
+			const safe_int old{*this};
+			--*this;
+			return old;
 		}
 		
-		constexpr safe_int& operator+() const {
+		constexpr safe_int operator+() const {
 			return *this;
 		}
 		
-		constexpr safe_int<typename impl::integer_type<bits, true>::type> operator-() const{
-			return *this * safe_int<typename impl::integer_type<bits, true>::type>{-1};
+		constexpr safe_int<typename impl::integer_type<bits, true>::type, Tpolicy> operator-() const{
+			using signed_base = typename impl::integer_type<bits, true>::type;
+			return safe_int<signed_base, Tpolicy>{signed_base{0}} 
+				- safe_int<signed_base, Tpolicy>{impl::checked_cast<signed_base, Tpolicy>(val)};
 		}
 		
 		constexpr base_type get_value() const {
@@ -255,134 +397,125 @@ class safe_int{
 		}
 		
 		template<typename Targ>
-		constexpr friend safe_int operator<<(const safe_int& lhs, const safe_int<Targ>& rhs){
-			return shift_check(lhs.val, rhs.val), safe_int{lhs.val<<rhs.val};
+		constexpr friend safe_int operator<<(const safe_int& lhs, const safe_int<Targ, Tpolicy>& rhs){
+			return lhs << rhs.get_value();
 		}
 		template<typename Targ>
-		safe_int& operator <<=(const safe_int<Targ>& other){
-			shift_check(val, other.val);
-			val<<=other.val;
-			return *this;
+		safe_int& operator <<=(const safe_int<Targ, Tpolicy>& other){
+			return (*this = *this << other.get_value());
 		}
 		
 		template<typename Targ,
-			typename = typename std::enable_if<std::is_integral<Targ>::value>::type>
+			typename = typename std::enable_if<impl::is_integer<Targ>::value>::type>
 		constexpr friend safe_int operator<<(const safe_int& lhs, const Targ& rhs){
-			return shift_check(lhs.val, rhs),  safe_int{lhs.val<<rhs};
+			return shift_valid(lhs.val, rhs) ? safe_int{lhs.val<<rhs} : safe_int{shift_error()};
 		}
 		template<typename Targ,
-			typename = typename std::enable_if<std::is_integral<Targ>::value>::type>
+			typename = typename std::enable_if<impl::is_integer<Targ>::value>::type>
 		safe_int& operator <<=(const Targ& other){
-			shift_check(val, other);
-			val<<=other;
-			return *this;
+			return (*this = *this << other);
 		}
 		
 		
 		template<typename Targ>
-		constexpr friend safe_int operator>>(const safe_int& lhs, const safe_int<Targ>& rhs){
-				return shift_check(lhs.val, rhs.val), safe_int{lhs.val>>rhs.val};
+		constexpr friend safe_int operator>>(const safe_int& lhs, const safe_int<Targ, Tpolicy>& rhs){
+				return lhs >> rhs.get_value();
 		}
 		template<typename Targ>
-		safe_int& operator >>=(const safe_int<Targ>& other){
-			shift_check(val, other.val);
-			val>>=other.val;
-			return *this;
+		safe_int& operator >>=(const safe_int<Targ, Tpolicy>& other){
+			return (*this = *this >> other.get_value());
 		}
 		
 		template<typename Targ,
-			typename = typename std::enable_if<std::is_integral<Targ>::value>::type>
+			typename = typename std::enable_if<impl::is_integer<Targ>::value>::type>
 		constexpr friend safe_int operator>>(const safe_int& lhs, const Targ& rhs){
-				return shift_check(lhs.val, rhs), safe_int{lhs.val>>rhs};
+				return shift_valid(lhs.val, rhs) ? safe_int{lhs.val>>rhs} : safe_int{shift_error()};
 		}
 		template<typename Targ,
-			typename = typename std::enable_if<std::is_integral<Targ>::value>::type>
+			typename = typename std::enable_if<impl::is_integer<Targ>::value>::type>
 		safe_int& operator >>=(const Targ& other){
-			shift_check(val, other);
-			val>>=other;
-			return *this;
+			return (*this = *this >> other);
 		}
 };
 
-template<typename Tlhs, typename Trhs>
-constexpr auto operator+(safe_int<Tlhs> lhs, safe_int<Trhs> rhs)
--> safe_int<typename impl::shared_type<Tlhs, Trhs>::type>
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+constexpr auto operator+(safe_int<Tlhs, Tpolicy> lhs, safe_int<Trhs, Tpolicy> rhs)
+-> safe_int<typename impl::shared_type<Tlhs, Trhs>::type, Tpolicy>
 {
 	typedef typename impl::shared_type<Tlhs, Trhs>::type return_base;
-	typedef safe_int<return_base> return_type;
-	return return_type{impl::checked_cast<return_base>(lhs.get_value())} +
-		return_type{impl::checked_cast<return_base>(rhs.get_value())};
+	typedef safe_int<return_base, Tpolicy> return_type;
+	return return_type{impl::checked_cast<return_base, Tpolicy>(lhs.get_value())} +
+		return_type{impl::checked_cast<return_base, Tpolicy>(rhs.get_value())};
 }
 
 
-template<typename Tlhs, typename Trhs>
-constexpr auto operator-(safe_int<Tlhs> lhs, safe_int<Trhs> rhs)
--> safe_int<typename impl::shared_type<Tlhs, Trhs>::type>
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+constexpr auto operator-(safe_int<Tlhs, Tpolicy> lhs, safe_int<Trhs, Tpolicy> rhs)
+-> safe_int<typename impl::shared_type<Tlhs, Trhs>::type, Tpolicy>
 {
 	typedef typename impl::shared_type<Tlhs, Trhs>::type return_base;
-	typedef safe_int<return_base> return_type;
-	return return_type{impl::checked_cast<return_base>(lhs.get_value())} -
-		return_type{impl::checked_cast<return_base>(rhs.get_value())};
+	typedef safe_int<return_base, Tpolicy> return_type;
+	return return_type{impl::checked_cast<return_base, Tpolicy>(lhs.get_value())} -
+		return_type{impl::checked_cast<return_base, Tpolicy>(rhs.get_value())};
 }
 
-template<typename Tlhs, typename Trhs>
-constexpr auto operator*(safe_int<Tlhs> lhs, safe_int<Trhs> rhs)
--> safe_int<typename impl::shared_type<Tlhs, Trhs>::type>
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+constexpr auto operator*(safe_int<Tlhs, Tpolicy> lhs, safe_int<Trhs, Tpolicy> rhs)
+-> safe_int<typename impl::shared_type<Tlhs, Trhs>::type, Tpolicy>
 {
 	typedef typename impl::shared_type<Tlhs, Trhs>::type return_base;
-	typedef safe_int<return_base> return_type;
-	return return_type{impl::checked_cast<return_base>(lhs.get_value())} *
-		return_type{impl::checked_cast<return_base>(rhs.get_value())};
+	typedef safe_int<return_base, Tpolicy> return_type;
+	return return_type{impl::checked_cast<return_base, Tpolicy>(lhs.get_value())} *
+		return_type{impl::checked_cast<return_base, Tpolicy>(rhs.get_value())};
 }
 
-template<typename Tlhs, typename Trhs>
-constexpr auto operator/(safe_int<Tlhs> lhs, safe_int<Trhs> rhs)
--> safe_int<typename impl::shared_type<Tlhs, Trhs>::type>
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+constexpr auto operator/(safe_int<Tlhs, Tpolicy> lhs, safe_int<Trhs, Tpolicy> rhs)
+-> safe_int<typename impl::shared_type<Tlhs, Trhs>::type, Tpolicy>
 {
 	typedef typename impl::shared_type<Tlhs, Trhs>::type return_base;
-	typedef safe_int<return_base> return_type;
-	return return_type{impl::checked_cast<return_base>(lhs.get_value())} /
-		return_type{impl::checked_cast<return_base>(rhs.get_value())};
+	typedef safe_int<return_base, Tpolicy> return_type;
+	return return_type{impl::checked_cast<return_base, Tpolicy>(lhs.get_value())} /
+		return_type{impl::checked_cast<return_base, Tpolicy>(rhs.get_value())};
 }
 
-template<typename Tlhs, typename Trhs>
-constexpr auto operator%(safe_int<Tlhs> lhs, safe_int<Trhs> rhs)
--> safe_int<typename impl::shared_type<Tlhs, Trhs>::type>
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+constexpr auto operator%(safe_int<Tlhs, Tpolicy> lhs, safe_int<Trhs, Tpolicy> rhs)
+-> safe_int<typename impl::shared_type<Tlhs, Trhs>::type, Tpolicy>
 {
 	typedef typename impl::shared_type<Tlhs, Trhs>::type return_base;
-	typedef safe_int<return_base> return_type;
-	return return_type{impl::checked_cast<return_base>(lhs.get_value())} %
-		return_type{impl::checked_cast<return_base>(rhs.get_value())};
+	typedef safe_int<return_base, Tpolicy> return_type;
+	return return_type{impl::checked_cast<return_base, Tpolicy>(lhs.get_value())} %
+		return_type{impl::checked_cast<return_base, Tpolicy>(rhs.get_value())};
 }
 
 // comparisions:
 
-template<typename Tlhs, typename Trhs>
-constexpr inline bool operator==(const safe_int<Tlhs>& lhs, const safe_int<Trhs>& rhs){
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+constexpr inline bool operator==(const safe_int<Tlhs, Tpolicy>& lhs, const safe_int<Trhs, Tpolicy>& rhs){
 	using common_base = typename impl::shared_type<Tlhs, Trhs>::type;
-	return (std::is_signed<common_base>::value ? (
-			(!std::is_signed<Tlhs>::value) && impl::in_range<common_base, Tlhs>(lhs.get_value())
-		):(
-			(!std::is_signed<Trhs>::value) && impl::in_range<common_base, Trhs>(rhs.get_value())
-		)) ? static_cast<common_base>(lhs.get_value()) == static_cast<common_base>(rhs.get_value()) 
-			: false;
+	return (impl::is_signed<common_base>::value && (
+			((!impl::is_signed<Tlhs>::value) && !impl::in_range<common_base, Tlhs>(lhs.get_value()))
+			|| ((!impl::is_signed<Trhs>::value) && !impl::in_range<common_base, Trhs>(rhs.get_value()))
+		)) ? false
+			: static_cast<common_base>(lhs.get_value()) == static_cast<common_base>(rhs.get_value());
 }
 
-template<typename Tlhs, typename Trhs>
-constexpr inline bool operator!=(const safe_int<Tlhs>& lhs, const safe_int<Trhs>& rhs){
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+constexpr inline bool operator!=(const safe_int<Tlhs, Tpolicy>& lhs, const safe_int<Trhs, Tpolicy>& rhs){
 	return !(lhs == rhs);
 }
 
-template<typename Tlhs, typename Trhs>
-bool operator<(const safe_int<Tlhs>& lhs, const safe_int<Trhs>& rhs){
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+bool operator<(const safe_int<Tlhs, Tpolicy>& lhs, const safe_int<Trhs, Tpolicy>& rhs){
 	using common_base = typename impl::shared_type<Tlhs, Trhs>::type;
-	if(std::is_signed<common_base>::value){
-		if(!std::is_signed<Tlhs>::value){
+	if(impl::is_signed<common_base>::value){
+		if(!impl::is_signed<Tlhs>::value){
 			if(!impl::in_range<common_base, Tlhs>(lhs.get_value())){
 				return false;
 			}
 		}
-		else if(!std::is_signed<Trhs>::value){
+		else if(!impl::is_signed<Trhs>::value){
 			if(!impl::in_range<common_base, Trhs>(rhs.get_value())){
 				return true;
 			}
@@ -391,16 +524,16 @@ bool operator<(const safe_int<Tlhs>& lhs, const safe_int<Trhs>& rhs){
 	return static_cast<common_base>(lhs.get_value()) < static_cast<common_base>(rhs.get_value());
 }
 
-template<typename Tlhs, typename Trhs>
-bool operator<=(const safe_int<Tlhs>& lhs, const safe_int<Trhs>& rhs){
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+bool operator<=(const safe_int<Tlhs, Tpolicy>& lhs, const safe_int<Trhs, Tpolicy>& rhs){
 	using common_base = typename impl::shared_type<Tlhs, Trhs>::type;
-	if(std::is_signed<common_base>::value){
-		if(!std::is_signed<Tlhs>::value){
+	if(impl::is_signed<common_base>::value){
+		if(!impl::is_signed<Tlhs>::value){
 			if(!impl::in_range<common_base, Tlhs>(lhs.get_value())){
 				return false;
 			}
 		}
-		else if(!std::is_signed<Trhs>::value){
+		else if(!impl::is_signed<Trhs>::value){
 			if(!impl::in_range<common_base, Trhs>(rhs.get_value())){
 				return true;
 			}
@@ -409,16 +542,16 @@ bool operator<=(const safe_int<Tlhs>& lhs, const safe_int<Trhs>& rhs){
 	return static_cast<common_base>(lhs.get_value()) <= static_cast<common_base>(rhs.get_value());
 }
 
-template<typename Tlhs, typename Trhs>
-bool operator>(const safe_int<Tlhs>& lhs, const safe_int<Trhs>& rhs){
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+bool operator>(const safe_int<Tlhs, Tpolicy>& lhs, const safe_int<Trhs, Tpolicy>& rhs){
 	using common_base = typename impl::shared_type<Tlhs, Trhs>::type;
-	if(std::is_signed<common_base>::value){
-		if(!std::is_signed<Tlhs>::value){
+	if(impl::is_signed<common_base>::value){
+		if(!impl::is_signed<Tlhs>::value){
 			if(!impl::in_range<common_base, Tlhs>(lhs.get_value())){
 				return true;
 			}
 		}
-		else if(!std::is_signed<Trhs>::value){
+		else if(!impl::is_signed<Trhs>::value){
 			if(!impl::in_range<common_base, Trhs>(rhs.get_value())){
 				return false;
 			}
@@ -427,16 +560,16 @@ bool operator>(const safe_int<Tlhs>& lhs, const safe_int<Trhs>& rhs){
 	return static_cast<common_base>(lhs.get_value()) > static_cast<common_base>(rhs.get_value());
 }
 
-template<typename Tlhs, typename Trhs>
-bool operator>=(const safe_int<Tlhs>& lhs, const safe_int<Trhs>& rhs){
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+bool operator>=(const safe_int<Tlhs, Tpolicy>& lhs, const safe_int<Trhs, Tpolicy>& rhs){
 	using common_base = typename impl::shared_type<Tlhs, Trhs>::type;
-	if(std::is_signed<common_base>::value){
-		if(!std::is_signed<Tlhs>::value){
+	if(impl::is_signed<common_base>::value){
+		if(!impl::is_signed<Tlhs>::value){
 			if(!impl::in_range<common_base, Tlhs>(lhs.get_value())){
 				return true;
 			}
 		}
-		else if(!std::is_signed<Trhs>::value){
+		else if(!impl::is_signed<Trhs>::value){
 			if(!impl::in_range<common_base, Trhs>(rhs.get_value())){
 				return false;
 			}
@@ -445,16 +578,107 @@ bool operator>=(const safe_int<Tlhs>& lhs, const safe_int<Trhs>& rhs){
 	return static_cast<common_base>(lhs.get_value()) >= static_cast<common_base>(rhs.get_value());
 }
 
+namespace impl{
+
+template<typename Tchar, typename T>
+void write_integer(std::basic_ostream<Tchar>& stream, T value){
+	stream << value;
+}
+
 template<typename Tchar, typename T>
-std::basic_ostream<Tchar>& operator<<(std::basic_ostream<Tchar>& stream, const safe_int<T>& value){
-	return (stream << value.get_value());
+void read_integer(std::basic_istream<Tchar>& stream, T& value){
+	stream >> value;
+}
+
+#if defined(TYPE_BUILDER_HAS_INT128)
+
+// The streams don't know the 128 bit integers, so these are written and read as
+// decimal numbers by hand; formatting-flags other than the width are ignored and
+// a number is read as one whitespace-delimited word.
+
+// writes the digits of value in front of end and returns a pointer to the first one:
+inline char* format_digits(uint128_t value, char* end){
+	*--end = '\0';
+	do{
+		*--end = static_cast<char>('0' + static_cast<int>(value % 10));
+		value /= 10;
+	} while(value != 0);
+	return end;
+}
+
+template<typename Tchar>
+void write_integer(std::basic_ostream<Tchar>& stream, uint128_t value){
+	char buffer[48];
+	stream << format_digits(value, buffer + sizeof(buffer));
+}
+
+template<typename Tchar>
+void write_integer(std::basic_ostream<Tchar>& stream, int128_t value){
+	char buffer[48];
+	char* begin = format_digits(value < 0 ? uint128_t{0} - static_cast<uint128_t>(value) :
+		static_cast<uint128_t>(value), buffer + sizeof(buffer));
+	if(value < 0){
+		*--begin = '-';
+	}
+	stream << begin;
 }
 
 template<typename Tchar, typename T>
-std::basic_istream<Tchar>& operator>>(std::basic_istream<Tchar>& stream, const safe_int<T>& value){
+void read_integer_128(std::basic_istream<Tchar>& stream, T& value){
+	// a word of the stream, without <string>; words that fill the buffer are far
+	// longer than the 40 characters of any number and rejected:
+	Tchar text[64];
+	stream.width(sizeof(text) / sizeof(Tchar));
+	if(!(stream >> text)){
+		return;
+	}
+	const std::size_t length = std::char_traits<Tchar>::length(text);
+	const bool negative = (text[0] == stream.widen('-'));
+	const std::size_t first = (negative || text[0] == stream.widen('+')) ? 1 : 0;
+	const uint128_t limit = negative ?
+		uint128_t{0} - static_cast<uint128_t>(std::numeric_limits<T>::min()) :
+		static_cast<uint128_t>(std::numeric_limits<T>::max());
+	uint128_t magnitude = 0;
+	bool valid = first < length && length + 1 < sizeof(text) / sizeof(Tchar)
+		&& (!negative || is_signed<T>::value);
+	for(std::size_t i = first; valid && i < length; ++i){
+		const char digit = stream.narrow(text[i], '\0');
+		valid = digit >= '0' && digit <= '9' && magnitude <= (limit - static_cast<unsigned>(digit - '0')) / 10;
+		magnitude = magnitude * 10 + static_cast<unsigned>(digit - '0');
+	}
+	if(!valid){
+		value = 0;
+		stream.setstate(stream.failbit);
+		return;
+	}
+	value = negative ? static_cast<T>(uint128_t{0} - magnitude) : static_cast<T>(magnitude);
+}
+
+template<typename Tchar>
+void read_integer(std::basic_istream<Tchar>& stream, uint128_t& value){
+	read_integer_128(stream, value);
+}
+
+template<typename Tchar>
+void read_integer(std::basic_istream<Tchar>& stream, int128_t& value){
+	read_integer_128(stream, value);
+}
+
+#endif
+
+} // namespace impl
+
+template<typename Tchar, typename T, typename Tpolicy>
+std::basic_ostream<Tchar>& operator<<(std::basic_ostream<Tchar>& stream, const safe_int<T, Tpolicy>& value){
+	impl::write_integer(stream, value.get_value());
+	return stream;
+}
+
+template<typename Tchar, typename T, typename Tpolicy>
+std::basic_istream<Tchar>& operator>>(std::basic_istream<Tchar>& stream, safe_int<T, Tpolicy>& value){
 	T tmp;
-	stream >> tmp;
-	value = safe_int<T>{tmp};
+	impl::read_integer(stream, tmp);
+	value = safe_int<T, Tpolicy>{tmp};
 	return stream;
 }
 
@@ -473,39 +697,70 @@ template<> struct integer_type<16,true>{typedef std::int16_t type;};
 template<> struct integer_type<32,true>{typedef std::int32_t type;};
 template<> struct integer_type<64,true>{typedef std::int64_t type;};
 
+#if defined(TYPE_BUILDER_HAS_INT128)
+template<> struct integer_type<128,false>{typedef uint128_t type;};
+template<> struct integer_type<128,true>{typedef int128_t type;};
+#endif
+
+template<typename T>
+struct always_void{
+	typedef void type;
+};
+
+template<typename T>
+struct identity{
+	typedef T type;
+};
+
+template<int Tsize, bool Tsigned, typename = void>
+struct has_integer_type: std::false_type {};
+
+template<int Tsize, bool Tsigned>
+struct has_integer_type<Tsize, Tsigned,
+	typename always_void<typename integer_type<Tsize, Tsigned>::type>::type>: std::true_type {};
+
+// Mixing signed and unsigned integers of the same size results in the signed type,
+// except for 64 bit integers, where the signed 128 bit type can hold all values of
+// both, if it exists:
 template<typename Tlhs, typename Trhs>
 struct shared_type{
-	typedef typename integer_type<
-			(sizeof(Tlhs) > sizeof(Trhs)? sizeof(Tlhs) : sizeof(Trhs)) * 8,
-			std::is_signed<Tlhs>::value || std::is_signed<Trhs>::value
-		>::type type;
+	constexpr static int size = (sizeof(Tlhs) > sizeof(Trhs)? sizeof(Tlhs) : sizeof(Trhs)) * 8;
+	constexpr static bool is_signed = impl::is_signed<Tlhs>::value || impl::is_signed<Trhs>::value;
+	constexpr static bool needs_more_bits = is_signed && size == 64 && has_integer_type<128, true>::value
+		&& ((!impl::is_signed<Tlhs>::value && sizeof(Tlhs) * 8 == 64)
+			|| (!impl::is_signed<Trhs>::value && sizeof(Trhs) * 8 == 64));
+	typedef typename integer_type<needs_more_bits ? 2 * size : size, is_signed>::type type;
 };
 
 template<typename Tsource_type, typename Ttarget_type, bool Trequire_check>
 struct convertable_check{
-	constexpr static bool check(const Tsource_type& value){
+	template<typename Tpolicy>
+	constexpr static Ttarget_type convert(const Tsource_type& value){
 		return (value > static_cast<Tsource_type>(std::numeric_limits<Ttarget_type>::max()))
-			? throw std::overflow_error("conversion failure") 
-			: true;
+			? Tpolicy::template on_error<std::overflow_error, Ttarget_type>(
+				std::numeric_limits<Ttarget_type>::max(), static_cast<Ttarget_type>(value),
+				"conversion failure")
+			: static_cast<Ttarget_type>(value);
 	}
 };
 template<typename Tsource_type, typename Ttarget_type>
 struct convertable_check<Tsource_type, Ttarget_type, false>{
-	constexpr static bool check(const Tsource_type&){
-		return true;
+	template<typename Tpolicy>
+	constexpr static Ttarget_type convert(const Tsource_type& value){
+		return static_cast<Ttarget_type>(value);
 	}
 };
 
-template<typename Ttarget_type, typename Tsource_type>
+template<typename Ttarget_type, typename Tpolicy, typename Tsource_type>
 constexpr Ttarget_type checked_cast(const Tsource_type& src){
 	static_assert(sizeof(Ttarget_type) >= sizeof(Tsource_type), 
 			"checked cast is not to be used for narrowing casts");
-	static_assert(std::is_signed<Tsource_type>::value ? std::is_signed<Ttarget_type>::value : true,
+	static_assert(impl::is_signed<Tsource_type>::value ? impl::is_signed<Ttarget_type>::value : true,
 			"checked cast does not cast from signed to unsigned");
 	return convertable_check<Tsource_type, Ttarget_type, 
-			std::is_signed<Ttarget_type>::value&&
-			(!std::is_signed<Tsource_type>::value)
-		>::check(src) , static_cast<Ttarget_type>(src);
+			impl::is_signed<Ttarget_type>::value&&
+			(!impl::is_signed<Tsource_type>::value)
+		>::template convert<Tpolicy>(src);
 }
 
 template<typename Tsigned, typename Tunsigned>
@@ -513,8 +768,218 @@ constexpr bool in_range(const Tunsigned& value){
 	return value <= static_cast<Tunsigned>(std::numeric_limits<Tsigned>::max());
 }
 
+template<typename T>
+constexpr bool is_negative(const T& value){
+	return sign_dependent_checks<T, impl::is_signed<T>::value>::is_negative(value);
+}
+
+// The range-checks of conversions compare directly in the source type, which is
+// correct for all combinations of sizes and signedness:
+
+template<typename Ttarget, typename Tsource>
+constexpr bool below_range(const Tsource& value){
+	return is_negative(value) && (!impl::is_signed<Ttarget>::value
+		|| (sizeof(Tsource) > sizeof(Ttarget)
+			&& value < static_cast<Tsource>(std::numeric_limits<Ttarget>::min())));
+}
+
+template<typename Ttarget, typename Tsource>
+constexpr bool above_range(const Tsource& value){
+	return !is_negative(value) && static_cast<typename impl::make_unsigned<Tsource>::type>(value)
+		> static_cast<typename impl::make_unsigned<Ttarget>::type>(std::numeric_limits<Ttarget>::max());
+}
+
+template<typename T>
+constexpr bool div_overflows(T lhs, T rhs){
+	return impl::is_signed<T>::value && lhs == std::numeric_limits<T>::min()
+		&& rhs == static_cast<T>(-1);
+}
+
+// The wrapping operations are done in an unsigned type that is at least as
+// wide as int, because smaller types would be promoted to (signed) int:
+template<typename T>
+struct wrapping_type{
+	typedef typename std::common_type<unsigned, typename impl::make_unsigned<T>::type>::type type;
+};
+
+template<typename T>
+constexpr T wrapping_add(T lhs, T rhs){
+	return static_cast<T>(static_cast<typename wrapping_type<T>::type>(lhs)
+		+ static_cast<typename wrapping_type<T>::type>(rhs));
+}
+
+template<typename T>
+constexpr T wrapping_sub(T lhs, T rhs){
+	return static_cast<T>(static_cast<typename wrapping_type<T>::type>(lhs)
+		- static_cast<typename wrapping_type<T>::type>(rhs));
+}
+
+template<typename T>
+constexpr T wrapping_mul(T lhs, T rhs){
+	return static_cast<T>(static_cast<typename wrapping_type<T>::type>(lhs)
+		* static_cast<typename wrapping_type<T>::type>(rhs));
+}
+
+// The overflow-checks use the builtins of the compiler if possible, since those 
+// boil down to the operation itself and a check of the overflow-flag. The portable
+// fallbacks are only used if the compiler doesn't provide them.
+
+#if defined(TYPE_BUILDER_HAS_OVERFLOW_PREDICATES)
+
+template<typename T>
+constexpr bool add_overflows(T lhs, T rhs){
+	return __builtin_add_overflow_p(lhs, rhs, T{});
+}
+
+template<typename T>
+constexpr bool sub_overflows(T lhs, T rhs){
+	return __builtin_sub_overflow_p(lhs, rhs, T{});
+}
+
+template<typename T>
+constexpr bool mul_overflows(T lhs, T rhs){
+	return __builtin_mul_overflow_p(lhs, rhs, T{});
+}
+
+#elif defined(TYPE_BUILDER_HAS_OVERFLOW_BUILTINS)
+
+template<typename T>
+constexpr bool add_overflows(T lhs, T rhs){
+	T result{};
+	return __builtin_add_overflow(lhs, rhs, &result);
+}
+
+template<typename T>
+constexpr bool sub_overflows(T lhs, T rhs){
+	T result{};
+	return __builtin_sub_overflow(lhs, rhs, &result);
+}
+
+template<typename T>
+constexpr bool mul_overflows(T lhs, T rhs){
+	T result{};
+	return __builtin_mul_overflow(lhs, rhs, &result);
+}
+
+#else
+
+template<typename T>
+constexpr bool add_overflows(T lhs, T rhs){
+	return is_negative(rhs) ?
+		lhs < std::numeric_limits<T>::min() - rhs :
+		lhs > std::numeric_limits<T>::max() - rhs;
+}
+
+template<typename T>
+constexpr bool sub_overflows(T lhs, T rhs){
+	return is_negative(rhs) ?
+		lhs > std::numeric_limits<T>::max() + rhs :
+		lhs < std::numeric_limits<T>::min() + rhs;
+}
+
+template<typename T>
+constexpr bool mul_overflows(T lhs, T rhs){
+	return (lhs == 0 || rhs == 0) ? false :
+		is_negative(lhs) ? (
+			is_negative(rhs) ?
+				lhs < std::numeric_limits<T>::max() / rhs :
+				lhs < std::numeric_limits<T>::min() / rhs
+		) : (
+			is_negative(rhs) ?
+				rhs < std::numeric_limits<T>::min() / lhs :
+				lhs > std::numeric_limits<T>::max() / rhs
+		);
+}
+
+#endif
+
 } // namespace impl
 
+// The instantiations of safe_int that most programs use, with Textern either empty
+// or extern. If TYPE_BUILDER_EXTERN_TEMPLATES is defined, they are declared extern
+// here and compiled only once into the library type_builder_instantiations, which
+// has to be linked then:
+#define TYPE_BUILDER_SAFE_INT_INSTANTIATIONS(Textern) \
+	Textern template class safe_int<std::int32_t>; \
+	Textern template class safe_int<std::int64_t>; \
+	Textern template class safe_int<std::uint32_t>; \
+	Textern template class safe_int<std::uint64_t>; \
+	TYPE_BUILDER_SAFE_INT_MIXED_INSTANTIATIONS(Textern, std::int32_t, std::int64_t, std::int64_t) \
+	TYPE_BUILDER_SAFE_INT_MIXED_INSTANTIATIONS(Textern, std::int64_t, std::int32_t, std::int64_t)
+
+#define TYPE_BUILDER_SAFE_INT_MIXED_INSTANTIATIONS(Textern, Tlhs, Trhs, Tresult) \
+	Textern template safe_int<Tresult> operator+(safe_int<Tlhs>, safe_int<Trhs>); \
+	Textern template safe_int<Tresult> operator-(safe_int<Tlhs>, safe_int<Trhs>); \
+	Textern template safe_int<Tresult> operator*(safe_int<Tlhs>, safe_int<Trhs>); \
+	Textern template safe_int<Tresult> operator/(safe_int<Tlhs>, safe_int<Trhs>); \
+	Textern template safe_int<Tresult> operator%(safe_int<Tlhs>, safe_int<Trhs>); \
+	Textern template bool operator==(const safe_int<Tlhs>&, const safe_int<Trhs>&); \
+	Textern template bool operator!=(const safe_int<Tlhs>&, const safe_int<Trhs>&); \
+	Textern template bool operator<(const safe_int<Tlhs>&, const safe_int<Trhs>&); \
+	Textern template bool operator<=(const safe_int<Tlhs>&, const safe_int<Trhs>&); \
+	Textern template bool operator>(const safe_int<Tlhs>&, const safe_int<Trhs>&); \
+	Textern template bool operator>=(const safe_int<Tlhs>&, const safe_int<Trhs>&);
+
+#if defined(TYPE_BUILDER_EXTERN_TEMPLATES)
+TYPE_BUILDER_SAFE_INT_INSTANTIATIONS(extern)
+#endif
+
 } // namespace type_builder
 
+namespace std{
+
+/**
+ * @brief The limits of a safe_int are those of T, but it only wraps around with
+ *        wrap_on_error.
+ */
+template<typename T, typename Tpolicy>
+class numeric_limits<type_builder::safe_int<T, Tpolicy>>: public type_builder::impl::integer_limits<T>{
+	using number = type_builder::safe_int<T, Tpolicy>;
+	using limits = type_builder::impl::integer_limits<T>;
+
+	public:
+		static constexpr bool is_modulo = std::is_same<Tpolicy, type_builder::wrap_on_error>::value;
+
+		static constexpr number min() noexcept{
+			return number{number::min};
+		}
+
+		static constexpr number max() noexcept{
+			return number{number::max};
+		}
+
+		static constexpr number lowest() noexcept{
+			return number{number::min};
+		}
+
+		static constexpr number epsilon() noexcept{
+			return number{limits::epsilon()};
+		}
+
+		static constexpr number round_error() noexcept{
+			return number{limits::round_error()};
+		}
+
+		static constexpr number infinity() noexcept{
+			return number{limits::infinity()};
+		}
+
+		static constexpr number quiet_NaN() noexcept{
+			return number{limits::quiet_NaN()};
+		}
+
+		static constexpr number signaling_NaN() noexcept{
+			return number{limits::signaling_NaN()};
+		}
+
+		static constexpr number denorm_min() noexcept{
+			return number{limits::denorm_min()};
+		}
+};
+
+template<typename T, typename Tpolicy>
+constexpr bool numeric_limits<type_builder::safe_int<T, Tpolicy>>::is_modulo;
+
+} // namespace std
+
 #endif
@@ -0,0 +1,448 @@
+#ifndef TYPE_BUILDER_SAFE_INT_BATCH_HPP
+#define TYPE_BUILDER_SAFE_INT_BATCH_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "safe_int.hpp"
+#include "span.hpp"
+
+namespace type_builder {
+
+/**
+ * @brief The outcome of a batch-operation.
+ */
+struct batch_result{
+	/// index of the first failing element or the size of the batch if none failed
+	std::size_t first_error;
+	/// number of failing elements
+	std::size_t errors;
+
+	constexpr bool ok() const {
+		return errors == 0;
+	}
+};
+
+namespace impl{
+
+// The batch-operations: overflows() must be free of branches so that the
+// compiler can compute it in SIMD-lanes, error() handles a failing element
+// exactly like the scalar operator of safe_int.
+
+template<typename T, bool Tsigned = impl::is_signed<T>::value>
+struct batch_add{
+	static bool overflows(T lhs, T rhs){
+		return ((lhs ^ wrapping_add(lhs, rhs)) & (rhs ^ wrapping_add(lhs, rhs))) < 0;
+	}
+	static T apply(T lhs, T rhs){
+		return wrapping_add(lhs, rhs);
+	}
+	template<typename Tpolicy>
+	static T error(T lhs, T rhs, const char* what){
+		return (rhs > 0) ?
+			Tpolicy::template on_error<std::overflow_error>(
+				std::numeric_limits<T>::max(), wrapping_add(lhs, rhs), what) :
+			Tpolicy::template on_error<std::underflow_error>(
+				std::numeric_limits<T>::min(), wrapping_add(lhs, rhs), what);
+	}
+};
+
+template<typename T>
+struct batch_add<T, false>{
+	static bool overflows(T lhs, T rhs){
+		return wrapping_add(lhs, rhs) < lhs;
+	}
+	static T apply(T lhs, T rhs){
+		return wrapping_add(lhs, rhs);
+	}
+	template<typename Tpolicy>
+	static T error(T lhs, T rhs, const char* what){
+		return Tpolicy::template on_error<std::overflow_error>(
+				std::numeric_limits<T>::max(), wrapping_add(lhs, rhs), what);
+	}
+};
+
+template<typename T, bool Tsigned = impl::is_signed<T>::value>
+struct batch_sub{
+	static bool overflows(T lhs, T rhs){
+		return ((lhs ^ rhs) & (lhs ^ wrapping_sub(lhs, rhs))) < 0;
+	}
+	static T apply(T lhs, T rhs){
+		return wrapping_sub(lhs, rhs);
+	}
+	template<typename Tpolicy>
+	static T error(T lhs, T rhs, const char* what){
+		return (rhs < 0) ?
+			Tpolicy::template on_error<std::overflow_error>(
+				std::numeric_limits<T>::max(), wrapping_sub(lhs, rhs), what) :
+			Tpolicy::template on_error<std::underflow_error>(
+				std::numeric_limits<T>::min(), wrapping_sub(lhs, rhs), what);
+	}
+};
+
+template<typename T>
+struct batch_sub<T, false>{
+	static bool overflows(T lhs, T rhs){
+		return lhs < rhs;
+	}
+	static T apply(T lhs, T rhs){
+		return wrapping_sub(lhs, rhs);
+	}
+	template<typename Tpolicy>
+	static T error(T lhs, T rhs, const char* what){
+		return Tpolicy::template on_error<std::underflow_error>(
+				std::numeric_limits<T>::min(), wrapping_sub(lhs, rhs), what);
+	}
+};
+
+// Multiplications are checked in the type with twice as many bits if there is
+// one, since only that can be vectorized; otherwise the builtins are used:
+template<typename T, bool Twide = has_integer_type<2 * CHAR_BIT * sizeof(T), impl::is_signed<T>::value>::value>
+struct batch_mul_check{
+	typedef typename integer_type<2 * CHAR_BIT * sizeof(T), impl::is_signed<T>::value>::type wide_type;
+	static bool overflows(T lhs, T rhs){
+		return static_cast<wide_type>(static_cast<wide_type>(lhs) * static_cast<wide_type>(rhs))
+			!= static_cast<wide_type>(wrapping_mul(lhs, rhs));
+	}
+};
+
+template<typename T>
+struct batch_mul_check<T, false>{
+	static bool overflows(T lhs, T rhs){
+		return mul_overflows(lhs, rhs);
+	}
+};
+
+template<typename T>
+struct batch_mul: batch_mul_check<T>{
+	static T apply(T lhs, T rhs){
+		return wrapping_mul(lhs, rhs);
+	}
+	template<typename Tpolicy>
+	static T error(T lhs, T rhs, const char* what){
+		return Tpolicy::template on_error<std::overflow_error>(
+				(is_negative(lhs) == is_negative(rhs)) ?
+					std::numeric_limits<T>::max() : std::numeric_limits<T>::min(),
+				wrapping_mul(lhs, rhs), what);
+	}
+};
+
+// negation is a subtraction from 0; the second operand is ignored:
+template<typename T>
+struct batch_negate{
+	static_assert(impl::is_signed<T>::value, "only signed safe_ints can be negated in batches");
+	static bool overflows(T value, T){
+		return value == std::numeric_limits<T>::min();
+	}
+	static T apply(T value, T){
+		return wrapping_sub(T{0}, value);
+	}
+	template<typename Tpolicy>
+	static T error(T value, T, const char* what){
+		return Tpolicy::template on_error<std::overflow_error>(
+				std::numeric_limits<T>::max(), wrapping_sub(T{0}, value), what);
+	}
+};
+
+// Elements are processed in blocks that fit into the L1-cache: the first pass over
+// a block only collects the overflow-mask, the second one writes the results
+// unchecked if no lane failed. Blocks that contain a failing element are redone
+// element by element, so that the policy is called for the failing elements in
+// order and the outputs before the first error are set, just as with a loop over
+// the scalar operators.
+TYPE_BUILDER_INLINE_VARIABLE constexpr std::size_t batch_block_size = 256;
+
+template<typename Top, typename T, typename Tpolicy>
+TYPE_BUILDER_COLD void batch_block_errors(const safe_int<T, Tpolicy>* lhs,
+		const safe_int<T, Tpolicy>* rhs, safe_int<T, Tpolicy>* out, std::size_t size,
+		std::size_t offset, batch_result& result){
+	char what[96];
+	for(std::size_t i = 0; i < size; ++i){
+		const T l = lhs[i].get_value();
+		const T r = rhs[i].get_value();
+		if(!Top::overflows(l, r)){
+			out[i] = safe_int<T, Tpolicy>{Top::apply(l, r)};
+			continue;
+		}
+		if(result.errors++ == 0){
+			result.first_error = offset + i;
+		}
+		std::snprintf(what, sizeof(what), "safe_int batch-operation failed at index %zu", offset + i);
+		out[i] = safe_int<T, Tpolicy>{Top::template error<Tpolicy>(l, r, what)};
+	}
+}
+
+template<typename Top, typename T, typename Tpolicy>
+batch_result batch_apply(const safe_int<T, Tpolicy>* lhs, const safe_int<T, Tpolicy>* rhs,
+		safe_int<T, Tpolicy>* out, std::size_t size, bool* mask){
+	batch_result result{size, 0};
+	for(std::size_t block = 0; block < size; block += batch_block_size){
+		const std::size_t block_size = (size - block < batch_block_size) ?
+			size - block : batch_block_size;
+		const safe_int<T, Tpolicy>* l = lhs + block;
+		const safe_int<T, Tpolicy>* r = rhs + block;
+		safe_int<T, Tpolicy>* o = out + block;
+		unsigned failed = 0;
+		if(mask){
+			for(std::size_t i = 0; i < block_size; ++i){
+				mask[block + i] = Top::overflows(l[i].get_value(), r[i].get_value());
+				failed |= mask[block + i];
+			}
+		}
+		else{
+			for(std::size_t i = 0; i < block_size; ++i){
+				failed |= Top::overflows(l[i].get_value(), r[i].get_value());
+			}
+		}
+		if(failed){
+			batch_block_errors<Top>(l, r, o, block_size, block, result);
+			continue;
+		}
+		for(std::size_t i = 0; i < block_size; ++i){
+			o[i] = safe_int<T, Tpolicy>{Top::apply(l[i].get_value(), r[i].get_value())};
+		}
+	}
+	return result;
+}
+
+template<typename Top, typename T, typename Tpolicy>
+batch_result batch_apply(span<const safe_int<T, Tpolicy>> lhs, span<const safe_int<T, Tpolicy>> rhs,
+		span<safe_int<T, Tpolicy>> out, span<bool> mask){
+	if(lhs.size() != out.size() || rhs.size() != out.size()
+			|| !(mask.empty() || mask.size() == out.size())){
+		throw std::length_error{"spans of batch-operation differ in size"};
+	}
+	return batch_apply<Top>(lhs.data(), rhs.data(), out.data(), out.size(),
+			mask.empty() ? nullptr : mask.data());
+}
+
+// Conversions from another arithmetic type into T; like the operations, fails()
+// is free of branches and error() calls the policy like the converting
+// constructor of safe_int:
+
+template<typename T, typename Tsource, bool Tfloat = std::is_floating_point<Tsource>::value>
+struct batch_convert{
+	// the bounds of the range of T in Tsource, or the ones of Tsource itself if it
+	// has no values beyond them:
+	constexpr static Tsource lower(){
+		return below_range<T>(std::numeric_limits<Tsource>::min()) ?
+			static_cast<Tsource>(impl::is_signed<T>::value ? std::numeric_limits<T>::min() : 0) :
+			std::numeric_limits<Tsource>::min();
+	}
+	constexpr static Tsource upper(){
+		return above_range<T>(std::numeric_limits<Tsource>::max()) ?
+			static_cast<Tsource>(std::numeric_limits<T>::max()) :
+			std::numeric_limits<Tsource>::max();
+	}
+	static bool fails(Tsource value){
+		return (value < lower()) | (value > upper());
+	}
+	static T apply(Tsource value){
+		return static_cast<T>(value);
+	}
+	template<typename Tpolicy>
+	static T error(Tsource value, const char* what){
+		return Tpolicy::template on_error<std::out_of_range>(
+				is_negative(value) ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max(),
+				static_cast<T>(value), what);
+	}
+};
+
+// Floating point values fail if they are NaN, out of range or not integral. The
+// bounds of the range of T are powers of two (or zero), so they are exact in any
+// floating point type and the comparisons with them need no rounding.
+// The values are not converted to T for the check, since a conditional conversion
+// keeps the compiler from vectorizing the loop; instead adding 2^(digits-1) to the
+// magnitude of a smaller value rounds it to an integer, which differs from the
+// value exactly if that has a fractional part (in every rounding mode), and all
+// larger values are integers:
+template<typename T, typename Tsource>
+struct batch_convert<T, Tsource, true>{
+	constexpr static Tsource lower(){
+		return static_cast<Tsource>(std::numeric_limits<T>::min());
+	}
+	constexpr static Tsource upper(){
+		return static_cast<Tsource>(std::numeric_limits<T>::max() / 2 + 1) * 2;
+	}
+	constexpr static Tsource integral_bound(){
+		return static_cast<Tsource>(std::uintmax_t{1} << (std::numeric_limits<Tsource>::digits - 1));
+	}
+	static bool fails(Tsource value){
+		// comparisons with NaN are false:
+		const bool in_range = (value >= lower()) & (value < upper());
+		const Tsource magnitude = std::fabs(value);
+		const bool integral = (magnitude >= integral_bound())
+			| (static_cast<Tsource>(static_cast<Tsource>(magnitude + integral_bound()) - integral_bound()) == magnitude);
+		return !(in_range & integral);
+	}
+	static T apply(Tsource value){
+		return static_cast<T>(value);
+	}
+	template<typename Tpolicy>
+	static T error(Tsource value, const char* what){
+		return std::isnan(value) ?
+				Tpolicy::template on_error<std::domain_error>(T{0}, T{0}, what) :
+			(value < lower()) ?
+				Tpolicy::template on_error<std::out_of_range>(
+					std::numeric_limits<T>::min(), std::numeric_limits<T>::min(), what) :
+			(value >= upper()) ?
+				Tpolicy::template on_error<std::out_of_range>(
+					std::numeric_limits<T>::max(), std::numeric_limits<T>::max(), what) :
+				// the fractional part would be lost:
+				Tpolicy::template on_error<std::domain_error>(
+					static_cast<T>(value), static_cast<T>(value), what);
+	}
+};
+
+template<typename Tconvert, typename Tsource, typename T, typename Tpolicy>
+TYPE_BUILDER_COLD void batch_convert_errors(const Tsource* values, safe_int<T, Tpolicy>* out,
+		std::size_t size, std::size_t offset, batch_result& result){
+	char what[96];
+	for(std::size_t i = 0; i < size; ++i){
+		const Tsource value = values[i];
+		if(!Tconvert::fails(value)){
+			out[i] = safe_int<T, Tpolicy>{Tconvert::apply(value)};
+			continue;
+		}
+		if(result.errors++ == 0){
+			result.first_error = offset + i;
+		}
+		std::snprintf(what, sizeof(what), "safe_int conversion failed at index %zu", offset + i);
+		out[i] = safe_int<T, Tpolicy>{Tconvert::template error<Tpolicy>(value, what)};
+	}
+}
+
+// the same two passes per block as in batch_apply:
+template<typename Tsource, typename T, typename Tpolicy>
+batch_result batch_convert_values(const Tsource* values, safe_int<T, Tpolicy>* out,
+		std::size_t size, bool* mask){
+	typedef batch_convert<T, Tsource> convert;
+	batch_result result{size, 0};
+	for(std::size_t block = 0; block < size; block += batch_block_size){
+		const std::size_t block_size = (size - block < batch_block_size) ?
+			size - block : batch_block_size;
+		const Tsource* v = values + block;
+		safe_int<T, Tpolicy>* o = out + block;
+		unsigned failed = 0;
+		if(mask){
+			for(std::size_t i = 0; i < block_size; ++i){
+				mask[block + i] = convert::fails(v[i]);
+				failed |= mask[block + i];
+			}
+		}
+		else{
+			for(std::size_t i = 0; i < block_size; ++i){
+				failed |= convert::fails(v[i]);
+			}
+		}
+		if(failed){
+			batch_convert_errors<convert>(v, o, block_size, block, result);
+			continue;
+		}
+		for(std::size_t i = 0; i < block_size; ++i){
+			o[i] = safe_int<T, Tpolicy>{convert::apply(v[i])};
+		}
+	}
+	return result;
+}
+
+} // namespace impl
+
+/**
+ * @brief Adds two arrays of safe_ints elementwise: out[i] = lhs[i] + rhs[i].
+ *
+ * The additions are computed in SIMD-lanes; failing elements are handled by the
+ * policy in the same way as by the scalar operator, so a throwing policy throws
+ * for the first failing element (after all elements before it have been written).
+ * If mask is not empty, mask[i] is set to whether element i failed.
+ * out may be the same as lhs or rhs but must not otherwise overlap with them.
+ *
+ * @throws std::length_error if the sizes of the spans differ
+ */
+template<typename T, typename Tpolicy>
+batch_result checked_add(typename impl::identity<span<const safe_int<T, Tpolicy>>>::type lhs,
+		typename impl::identity<span<const safe_int<T, Tpolicy>>>::type rhs,
+		span<safe_int<T, Tpolicy>> out, span<bool> mask = {}){
+	return impl::batch_apply<impl::batch_add<T>>(lhs, rhs, out, mask);
+}
+
+/**
+ * @brief Subtracts two arrays of safe_ints elementwise: out[i] = lhs[i] - rhs[i].
+ * @see checked_add
+ */
+template<typename T, typename Tpolicy>
+batch_result checked_sub(typename impl::identity<span<const safe_int<T, Tpolicy>>>::type lhs,
+		typename impl::identity<span<const safe_int<T, Tpolicy>>>::type rhs,
+		span<safe_int<T, Tpolicy>> out, span<bool> mask = {}){
+	return impl::batch_apply<impl::batch_sub<T>>(lhs, rhs, out, mask);
+}
+
+/**
+ * @brief Multiplies two arrays of safe_ints elementwise: out[i] = lhs[i] * rhs[i].
+ * @see checked_add
+ */
+template<typename T, typename Tpolicy>
+batch_result checked_mul(typename impl::identity<span<const safe_int<T, Tpolicy>>>::type lhs,
+		typename impl::identity<span<const safe_int<T, Tpolicy>>>::type rhs,
+		span<safe_int<T, Tpolicy>> out, span<bool> mask = {}){
+	return impl::batch_apply<impl::batch_mul<T>>(lhs, rhs, out, mask);
+}
+
+/**
+ * @brief Negates an array of signed safe_ints elementwise: out[i] = -values[i].
+ *
+ * Unlike the scalar operator the result has the same type as the operand, so
+ * the minimum of the type fails.
+ * @see checked_add
+ */
+template<typename T, typename Tpolicy>
+batch_result checked_negate(typename impl::identity<span<const safe_int<T, Tpolicy>>>::type values,
+		span<safe_int<T, Tpolicy>> out, span<bool> mask = {}){
+	return impl::batch_apply<impl::batch_negate<T>>(values, values, out, mask);
+}
+
+/**
+ * @brief Converts an integer or floating point value into a safe_int<T>.
+ *
+ * Unlike the converting constructor of safe_int this accepts floating point
+ * values; NaN and values with a fractional part are a std::domain_error, values
+ * outside the range of T a std::out_of_range.
+ */
+template<typename T, typename Tpolicy = throw_on_error, typename Tsource,
+	typename = typename std::enable_if<std::is_arithmetic<Tsource>::value>::type>
+safe_int<T, Tpolicy> checked_convert(Tsource value){
+	typedef impl::batch_convert<T, Tsource> convert;
+	return safe_int<T, Tpolicy>{convert::fails(value) ?
+		convert::template error<Tpolicy>(value, "safe_int conversion failed") :
+		convert::apply(value)};
+}
+
+/**
+ * @brief Converts an array of integers or floating point values into safe_ints
+ *        elementwise: out[i] = checked_convert<T>(values[i]).
+ *
+ * The checks are computed in SIMD-lanes and failing elements are reported like
+ * by checked_add. out may be the same memory as values only if their elements
+ * have the same size; it must not otherwise overlap with it.
+ *
+ * @throws std::length_error if the sizes of the spans differ
+ */
+template<typename Tcontainer, typename T, typename Tpolicy>
+batch_result checked_convert(const Tcontainer& values, span<safe_int<T, Tpolicy>> out,
+		span<bool> mask = {}){
+	const span<const typename Tcontainer::value_type> view{values};
+	if(view.size() != out.size() || !(mask.empty() || mask.size() == out.size())){
+		throw std::length_error{"spans of conversion differ in size"};
+	}
+	return impl::batch_convert_values(view.data(), out.data(), out.size(),
+			mask.empty() ? nullptr : mask.data());
+}
+
+} // namespace type_builder
+
+#endif
@@ -0,0 +1,309 @@
+#ifndef TYPE_BUILDER_SAFE_INT_CONSTANT_HPP
+#define TYPE_BUILDER_SAFE_INT_CONSTANT_HPP
+
+#include <climits>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "safe_int.hpp"
+
+namespace type_builder {
+
+/**
+ * @brief An integer whose value is known at compile-time.
+ *
+ * Arithmetic of a safe_int with a safe_int_constant is checked like the one of two
+ * safe_ints, but the checks use bounds that are computed at compile-time: +, - and *
+ * need a single comparison, / and % by a constant need none, except for the
+ * division of the minimum by -1; division by a constant 0 doesn't compile.
+ * The result has the same type as the one with a safe_int<T> would have.
+ */
+template<typename T, T Tvalue>
+struct safe_int_constant{
+	static_assert(impl::is_integer<T>::value, "safe_int_constant holds only integral types");
+
+	typedef T base_type;
+
+	constexpr base_type get_value() const {
+		return Tvalue;
+	}
+
+	template<typename Tpolicy>
+	constexpr operator safe_int<T, Tpolicy>() const {
+		return safe_int<T, Tpolicy>{Tvalue};
+	}
+};
+
+namespace impl{
+
+/**
+ * @brief Checks whether low <= value <= high with a single comparison.
+ */
+template<typename T>
+constexpr bool in_bounds(T value, T low, T high){
+	typedef typename impl::make_unsigned<T>::type unsigned_type;
+	return static_cast<unsigned_type>(static_cast<unsigned_type>(value) - static_cast<unsigned_type>(low))
+		<= static_cast<unsigned_type>(static_cast<unsigned_type>(high) - static_cast<unsigned_type>(low));
+}
+
+/**
+ * @brief The operations of a value of T with the constant Tvalue of type Tconstant.
+ *
+ * The operations are done in the type of the result; the bounds are the ranges of
+ * values for which the result of an operation with the constant stays in range.
+ */
+template<typename T, typename Tconstant, Tconstant Tvalue>
+struct constant_operation{
+	typedef typename shared_type<T, Tconstant>::type base_type;
+
+	static_assert(!below_range<base_type>(Tvalue) && !above_range<base_type>(Tvalue),
+			"the constant does not fit into the type of the result");
+
+	constexpr static base_type constant(){
+		return static_cast<base_type>(Tvalue);
+	}
+	constexpr static base_type min(){
+		return std::numeric_limits<base_type>::min();
+	}
+	constexpr static base_type max(){
+		return std::numeric_limits<base_type>::max();
+	}
+	constexpr static bool is_minus_one(){
+		return is_negative(constant()) && constant() == static_cast<base_type>(-1);
+	}
+
+	constexpr static base_type add_low(){
+		return is_negative(constant()) ? static_cast<base_type>(min() - constant()) : min();
+	}
+	constexpr static base_type add_high(){
+		return (constant() > 0) ? static_cast<base_type>(max() - constant()) : max();
+	}
+	constexpr static base_type sub_low(){
+		return (constant() > 0) ? static_cast<base_type>(min() + constant()) : min();
+	}
+	constexpr static base_type sub_high(){
+		return is_negative(constant()) ? static_cast<base_type>(max() + constant()) : max();
+	}
+	// the quotients are truncated towards zero, which rounds the bounds inwards:
+	constexpr static base_type mul_low(){
+		return (constant() > 0) ? static_cast<base_type>(min() / constant()) :
+			(constant() == 0) ? min() :
+			is_minus_one() ? static_cast<base_type>(-max()) :
+			static_cast<base_type>(max() / constant());
+	}
+	constexpr static base_type mul_high(){
+		return (constant() > 0) ? static_cast<base_type>(max() / constant()) :
+			(constant() == 0 || is_minus_one()) ? max() :
+			static_cast<base_type>(min() / constant());
+	}
+
+	template<typename Tpolicy>
+	constexpr static safe_int<base_type, Tpolicy> add(base_type lhs){
+		return in_bounds(lhs, add_low(), add_high()) ?
+			safe_int<base_type, Tpolicy>{static_cast<base_type>(lhs + constant())} :
+			safe_int<base_type, Tpolicy>{ (constant() > 0) ?
+				Tpolicy::template on_error<std::overflow_error>(max(), wrapping_add(lhs, constant()), "") :
+				Tpolicy::template on_error<std::underflow_error>(min(), wrapping_add(lhs, constant()), "") };
+	}
+
+	template<typename Tpolicy>
+	constexpr static safe_int<base_type, Tpolicy> sub(base_type lhs){
+		return in_bounds(lhs, sub_low(), sub_high()) ?
+			safe_int<base_type, Tpolicy>{static_cast<base_type>(lhs - constant())} :
+			safe_int<base_type, Tpolicy>{ is_negative(constant()) ?
+				Tpolicy::template on_error<std::overflow_error>(max(), wrapping_sub(lhs, constant()), "") :
+				Tpolicy::template on_error<std::underflow_error>(min(), wrapping_sub(lhs, constant()), "") };
+	}
+
+	template<typename Tpolicy>
+	constexpr static safe_int<base_type, Tpolicy> mul(base_type lhs){
+		return in_bounds(lhs, mul_low(), mul_high()) ?
+			safe_int<base_type, Tpolicy>{static_cast<base_type>(lhs * constant())} :
+			safe_int<base_type, Tpolicy>{ Tpolicy::template on_error<std::overflow_error>(
+				(is_negative(lhs) == is_negative(constant())) ? max() : min(),
+				wrapping_mul(lhs, constant()), "overflow in multiplication") };
+	}
+
+	template<typename Tpolicy>
+	constexpr static safe_int<base_type, Tpolicy> div(base_type lhs){
+		static_assert(Tvalue != 0, "integer-division by 0");
+		return (is_minus_one() && lhs == min()) ?
+			safe_int<base_type, Tpolicy>{ Tpolicy::template on_error<std::overflow_error>(
+				max(), min(), "overflow in division") } :
+			safe_int<base_type, Tpolicy>{static_cast<base_type>(lhs / constant())};
+	}
+
+	template<typename Tpolicy>
+	constexpr static safe_int<base_type, Tpolicy> mod(base_type lhs){
+		static_assert(Tvalue != 0, "modulo of 0");
+		return is_minus_one() ?
+			safe_int<base_type, Tpolicy>{base_type{0}} :
+			safe_int<base_type, Tpolicy>{static_cast<base_type>(lhs % constant())};
+	}
+};
+
+// parses the digits of a literal:
+template<unsigned long long Tvalue, char... Tdigits>
+struct decimal_literal{
+	constexpr static unsigned long long value = Tvalue;
+};
+
+template<unsigned long long Tvalue, char Tdigit, char... Trest>
+struct decimal_literal<Tvalue, Tdigit, Trest...>:
+		decimal_literal<Tvalue * 10 + static_cast<unsigned>(Tdigit - '0'), Trest...>{
+	static_assert('0' <= Tdigit && Tdigit <= '9', "safe_int_constant-literals must be decimal integers");
+	static_assert(Tvalue <= (ULLONG_MAX - 9) / 10, "safe_int_constant-literal is too large");
+};
+
+// like an unsuffixed decimal literal, the type is the first of int, long and long long
+// that can hold the value:
+template<char... Tdigits>
+struct constant_literal{
+	constexpr static unsigned long long value = decimal_literal<0, Tdigits...>::value;
+	static_assert(value <= static_cast<unsigned long long>(LLONG_MAX),
+			"safe_int_constant-literal is too large");
+	typedef typename std::conditional<value <= static_cast<unsigned long long>(INT_MAX), int,
+		typename std::conditional<value <= static_cast<unsigned long long>(LONG_MAX), long,
+			long long>::type>::type base_type;
+	typedef safe_int_constant<base_type, static_cast<base_type>(value)> type;
+};
+
+} // namespace impl
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+constexpr auto operator+(const safe_int<T, Tpolicy>& lhs, safe_int_constant<Tc, Tvalue>)
+-> safe_int<typename impl::constant_operation<T, Tc, Tvalue>::base_type, Tpolicy>
+{
+	typedef impl::constant_operation<T, Tc, Tvalue> operation;
+	return operation::template add<Tpolicy>(
+		impl::checked_cast<typename operation::base_type, Tpolicy>(lhs.get_value()));
+}
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+constexpr auto operator-(const safe_int<T, Tpolicy>& lhs, safe_int_constant<Tc, Tvalue>)
+-> safe_int<typename impl::constant_operation<T, Tc, Tvalue>::base_type, Tpolicy>
+{
+	typedef impl::constant_operation<T, Tc, Tvalue> operation;
+	return operation::template sub<Tpolicy>(
+		impl::checked_cast<typename operation::base_type, Tpolicy>(lhs.get_value()));
+}
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+constexpr auto operator*(const safe_int<T, Tpolicy>& lhs, safe_int_constant<Tc, Tvalue>)
+-> safe_int<typename impl::constant_operation<T, Tc, Tvalue>::base_type, Tpolicy>
+{
+	typedef impl::constant_operation<T, Tc, Tvalue> operation;
+	return operation::template mul<Tpolicy>(
+		impl::checked_cast<typename operation::base_type, Tpolicy>(lhs.get_value()));
+}
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+constexpr auto operator/(const safe_int<T, Tpolicy>& lhs, safe_int_constant<Tc, Tvalue>)
+-> safe_int<typename impl::constant_operation<T, Tc, Tvalue>::base_type, Tpolicy>
+{
+	typedef impl::constant_operation<T, Tc, Tvalue> operation;
+	return operation::template div<Tpolicy>(
+		impl::checked_cast<typename operation::base_type, Tpolicy>(lhs.get_value()));
+}
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+constexpr auto operator%(const safe_int<T, Tpolicy>& lhs, safe_int_constant<Tc, Tvalue>)
+-> safe_int<typename impl::constant_operation<T, Tc, Tvalue>::base_type, Tpolicy>
+{
+	typedef impl::constant_operation<T, Tc, Tvalue> operation;
+	return operation::template mod<Tpolicy>(
+		impl::checked_cast<typename operation::base_type, Tpolicy>(lhs.get_value()));
+}
+
+// with the constant on the left, only + and * profit from it:
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+constexpr auto operator+(safe_int_constant<Tc, Tvalue> lhs, const safe_int<T, Tpolicy>& rhs)
+-> decltype(rhs + lhs)
+{
+	return rhs + lhs;
+}
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+constexpr auto operator*(safe_int_constant<Tc, Tvalue> lhs, const safe_int<T, Tpolicy>& rhs)
+-> decltype(rhs * lhs)
+{
+	return rhs * lhs;
+}
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+constexpr auto operator-(safe_int_constant<Tc, Tvalue>, const safe_int<T, Tpolicy>& rhs)
+-> decltype(safe_int<Tc, Tpolicy>{Tvalue} - rhs)
+{
+	return safe_int<Tc, Tpolicy>{Tvalue} - rhs;
+}
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+constexpr auto operator/(safe_int_constant<Tc, Tvalue>, const safe_int<T, Tpolicy>& rhs)
+-> decltype(safe_int<Tc, Tpolicy>{Tvalue} / rhs)
+{
+	return safe_int<Tc, Tpolicy>{Tvalue} / rhs;
+}
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+constexpr auto operator%(safe_int_constant<Tc, Tvalue>, const safe_int<T, Tpolicy>& rhs)
+-> decltype(safe_int<Tc, Tpolicy>{Tvalue} % rhs)
+{
+	return safe_int<Tc, Tpolicy>{Tvalue} % rhs;
+}
+
+// the compound assignments convert the result back into T, which is checked only
+// if the result has a larger type:
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+safe_int<T, Tpolicy>& operator+=(safe_int<T, Tpolicy>& lhs, safe_int_constant<Tc, Tvalue> rhs){
+	return (lhs = safe_int<T, Tpolicy>{(lhs + rhs).get_value()});
+}
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+safe_int<T, Tpolicy>& operator-=(safe_int<T, Tpolicy>& lhs, safe_int_constant<Tc, Tvalue> rhs){
+	return (lhs = safe_int<T, Tpolicy>{(lhs - rhs).get_value()});
+}
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+safe_int<T, Tpolicy>& operator*=(safe_int<T, Tpolicy>& lhs, safe_int_constant<Tc, Tvalue> rhs){
+	return (lhs = safe_int<T, Tpolicy>{(lhs * rhs).get_value()});
+}
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+safe_int<T, Tpolicy>& operator/=(safe_int<T, Tpolicy>& lhs, safe_int_constant<Tc, Tvalue> rhs){
+	return (lhs = safe_int<T, Tpolicy>{(lhs / rhs).get_value()});
+}
+
+template<typename T, typename Tpolicy, typename Tc, Tc Tvalue>
+safe_int<T, Tpolicy>& operator%=(safe_int<T, Tpolicy>& lhs, safe_int_constant<Tc, Tvalue> rhs){
+	return (lhs = safe_int<T, Tpolicy>{(lhs % rhs).get_value()});
+}
+
+/**
+ * @brief Negates a constant at compile-time, so that -3_c is a constant as well.
+ */
+template<typename T, T Tvalue>
+constexpr safe_int_constant<T, static_cast<T>(0 - Tvalue)> operator-(safe_int_constant<T, Tvalue>){
+	static_assert(impl::is_signed<T>::value && Tvalue != std::numeric_limits<T>::min(),
+			"the negation of the constant does not fit into its type");
+	return {};
+}
+
+namespace literals{
+
+/**
+ * @brief Creates a safe_int_constant from a decimal literal: 1000_c is a
+ *        safe_int_constant<int, 1000>.
+ */
+template<char... Tdigits>
+constexpr typename impl::constant_literal<Tdigits...>::type operator"" _c(){
+	return {};
+}
+
+} // namespace literals
+
+} // namespace type_builder
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef TYPE_BUILDER_SAFE_INT_DIVISOR_HPP
+#define TYPE_BUILDER_SAFE_INT_DIVISOR_HPP
+
+#include <stdexcept>
+
+#include "divisor.hpp"
+#include "safe_int.hpp"
+
+namespace type_builder {
+
+/**
+ * @brief An invariant divisor of safe_ints (see divisor.hpp).
+ *
+ * The divisor is checked for 0 once when it is constructed instead of in every
+ * division; if the policy doesn't throw there, it divides by the value that the
+ * policy returns for 1 instead. Only the overflow of min / -1 is still checked by
+ * the divisions.
+ */
+template<typename T, typename Tpolicy>
+class divisor<safe_int<T, Tpolicy>>{
+	divisor<T> raw;
+
+	public:
+		typedef safe_int<T, Tpolicy> value_type;
+
+		explicit constexpr divisor(const value_type& value): raw{value.get_value() == 0 ?
+			Tpolicy::template on_error<std::domain_error>(T{1}, T{1}, "divisor of 0") :
+			value.get_value()}{}
+
+		constexpr value_type get_value() const noexcept{
+			return value_type{raw.get_value()};
+		}
+
+		friend constexpr value_type operator/(const value_type& lhs, const divisor& rhs){
+			return impl::div_overflows(lhs.get_value(), rhs.raw.get_value()) ?
+				value_type{ Tpolicy::template on_error<std::overflow_error>(
+					value_type::max, value_type::min, "overflow in division") } :
+				value_type{ rhs.raw.quotient(lhs.get_value()) };
+		}
+
+		friend constexpr value_type operator%(const value_type& lhs, const divisor& rhs){
+			return impl::div_overflows(lhs.get_value(), rhs.raw.get_value()) ?
+				value_type{ value_type::default_value } :
+				value_type{ rhs.raw.remainder(lhs.get_value()) };
+		}
+
+		friend value_type& operator/=(value_type& lhs, const divisor& rhs){
+			return lhs = lhs / rhs;
+		}
+
+		friend value_type& operator%=(value_type& lhs, const divisor& rhs){
+			return lhs = lhs % rhs;
+		}
+};
+
+} // namespace type_builder
+
+#endif
@@ -0,0 +1,330 @@
+#ifndef TYPE_BUILDER_SAFE_INT_PARALLEL_HPP
+#define TYPE_BUILDER_SAFE_INT_PARALLEL_HPP
+
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "safe_int.hpp"
+#include "safe_int_batch.hpp"
+#include "safe_accumulator.hpp"
+#include "span.hpp"
+
+namespace type_builder {
+
+/**
+ * @brief The outcome of a parallel reduction.
+ */
+template<typename T, typename Tpolicy>
+struct reduce_result{
+	/// the sum, as a sequential fold with safe_int::operator+ would have computed it
+	safe_int<T, Tpolicy> value;
+	/// index of the first element whose addition failed or the size of the range
+	std::size_t first_error;
+	/// number of failing additions
+	std::size_t errors;
+
+	constexpr bool ok() const {
+		return errors == 0;
+	}
+};
+
+namespace impl{
+
+// Ranges smaller than this are not worth to start a thread for:
+TYPE_BUILDER_INLINE_VARIABLE constexpr std::size_t parallel_min_chunk = std::size_t{1} << 14;
+
+/**
+ * @brief What a thread knows about its chunk without knowing the sum of the
+ *        elements before it: the sum of the chunk and bounds for the smallest and
+ *        largest partial sum within it, all in a type that is wider than T.
+ *
+ * The bounds are computed per block of elements from the sums of the positive and
+ * the negative elements, which can be vectorized, so they may be too wide; a chunk
+ * that might fail is summed exactly later. If a partial sum differs by more than the
+ * width of the range of T from zero, a sum in T must overflow somewhere in the
+ * chunk, whatever came before it; the thread stops there and sets certain_error.
+ */
+template<typename T>
+struct chunk_summary{
+	typedef typename accumulation_register<T>::type register_type;
+	register_type sum;
+	register_type low;
+	register_type high;
+	bool certain_error;
+
+	constexpr static std::size_t block_size = 256;
+
+	constexpr static register_type width(){
+		return static_cast<register_type>(static_cast<register_type>(std::numeric_limits<T>::max())
+			- static_cast<register_type>(std::numeric_limits<T>::min()));
+	}
+
+	template<typename Tpolicy>
+	static chunk_summary create(const safe_int<T, Tpolicy>* values, std::size_t size){
+		chunk_summary result{0, 0, 0, false};
+		for(std::size_t block = 0; block < size; block += block_size){
+			const std::size_t end = (size - block < block_size) ? size : block + block_size;
+			register_type positive = 0;
+			register_type negative = 0;
+			for(std::size_t i = block; i < end; ++i){
+				const register_type value = static_cast<register_type>(values[i].get_value());
+				positive = static_cast<register_type>(positive + (is_negative(value) ? 0 : value));
+				negative = static_cast<register_type>(negative + (is_negative(value) ? value : 0));
+			}
+			result.high = (result.sum + positive > result.high) ?
+				static_cast<register_type>(result.sum + positive) : result.high;
+			result.low = (result.sum + negative < result.low) ?
+				static_cast<register_type>(result.sum + negative) : result.low;
+			result.sum = static_cast<register_type>(result.sum + positive + negative);
+			if(result.sum > width() || (impl::is_signed<T>::value
+					&& result.sum < static_cast<register_type>(register_type{0} - width()))){
+				result.certain_error = true;
+				break;
+			}
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Checks whether adding the chunk to offset (which is in the range of T)
+	 *        overflows in any step.
+	 */
+	constexpr bool fails_after(register_type offset) const {
+		return certain_error
+			|| offset + high > static_cast<register_type>(std::numeric_limits<T>::max())
+			|| offset + low < static_cast<register_type>(std::numeric_limits<T>::min());
+	}
+};
+
+/**
+ * @brief Joins the threads that were started when it is destroyed, also if starting
+ *        another one or the work of the calling thread throws.
+ */
+struct thread_joiner{
+	std::vector<std::thread>& threads;
+
+	~thread_joiner(){
+		for(auto& thread: threads){
+			if(thread.joinable()){
+				thread.join();
+			}
+		}
+	}
+};
+
+/**
+ * @brief Runs function for the first count of chunks chunks of a range, each on
+ *        its own thread (the last one on the calling thread), and waits for them.
+ */
+template<typename Tfunction>
+void for_each_chunk(std::size_t size, std::size_t chunks, std::size_t count, Tfunction function){
+	if(count == 0){
+		return;
+	}
+	std::vector<std::thread> threads;
+	threads.reserve(count - 1);
+	const thread_joiner joiner{threads};
+	for(std::size_t chunk = 0; chunk + 1 < count; ++chunk){
+		threads.emplace_back(function, chunk, size * chunk / chunks, size * (chunk + 1) / chunks);
+	}
+	function(count - 1, size * (count - 1) / chunks, size * count / chunks);
+}
+
+inline std::size_t parallel_chunks(std::size_t size, unsigned threads){
+	if(threads == 0){
+		threads = std::thread::hardware_concurrency();
+	}
+	const std::size_t max_chunks = size / parallel_min_chunk;
+	return (threads == 0 || max_chunks == 0) ? 1 :
+		(max_chunks < threads) ? max_chunks : threads;
+}
+
+/**
+ * @brief Adds values[begin, size) to sum one after the other like the sequential
+ *        fold does, writing the partial sums to out if it is not null.
+ *
+ * This is used for small ranges and from the chunk on in which the first error
+ * occurs, so the policy sees the failing additions in order.
+ */
+template<typename T, typename Tpolicy>
+safe_int<T, Tpolicy> sequential_scan(const safe_int<T, Tpolicy>* values,
+		std::size_t begin, std::size_t size, safe_int<T, Tpolicy> sum, safe_int<T, Tpolicy>* out,
+		bool exclusive, std::size_t& first_error, std::size_t& errors){
+	char what[96];
+	for(std::size_t i = begin; i < size; ++i){
+		const T lhs = sum.get_value();
+		const T rhs = values[i].get_value();
+		if(out && exclusive){
+			out[i] = sum;
+		}
+		if(add_overflows(lhs, rhs)){
+			if(errors++ == 0){
+				first_error = i;
+				std::snprintf(what, sizeof(what),
+					"overflow in parallel sum at index %lu", static_cast<unsigned long>(i));
+			}
+			sum = safe_int<T, Tpolicy>{batch_add<T>::template error<Tpolicy>(lhs, rhs, what)};
+		}
+		else{
+			sum = safe_int<T, Tpolicy>{static_cast<T>(lhs + rhs)};
+		}
+		if(out && !exclusive){
+			out[i] = sum;
+		}
+	}
+	return sum;
+}
+
+/**
+ * @brief The common implementation of the reduction and the scans; out is null for
+ *        reductions.
+ */
+template<typename T, typename Tpolicy>
+reduce_result<T, Tpolicy> parallel_scan(const safe_int<T, Tpolicy>* values, std::size_t size,
+		safe_int<T, Tpolicy> init, safe_int<T, Tpolicy>* out, bool exclusive, unsigned threads,
+		std::true_type /* has wider type */){
+	typedef chunk_summary<T> summary;
+	typedef typename summary::register_type register_type;
+	reduce_result<T, Tpolicy> result{init, size, 0};
+	const std::size_t chunks = parallel_chunks(size, threads);
+
+	std::vector<summary> summaries(chunks);
+	for_each_chunk(size, chunks, chunks, [&](std::size_t chunk, std::size_t begin, std::size_t end){
+		summaries[chunk] = summary::create(values + begin, end - begin);
+	});
+
+	// find the first chunk that fails and the sums before each chunk:
+	std::vector<register_type> offsets(chunks);
+	register_type offset = static_cast<register_type>(init.get_value());
+	std::size_t failing = chunks;
+	for(std::size_t chunk = 0; chunk < chunks; ++chunk){
+		if(summaries[chunk].fails_after(offset)){
+			failing = chunk;
+			break;
+		}
+		offsets[chunk] = offset;
+		offset = static_cast<register_type>(offset + summaries[chunk].sum);
+	}
+
+	if(out){
+		for_each_chunk(size, chunks, failing,
+			[&](std::size_t chunk, std::size_t begin, std::size_t end){
+				register_type sum = offsets[chunk];
+				for(std::size_t i = begin; i < end; ++i){
+					const register_type value = static_cast<register_type>(values[i].get_value());
+					if(exclusive){
+						out[i] = safe_int<T, Tpolicy>{static_cast<T>(sum)};
+					}
+					sum = static_cast<register_type>(sum + value);
+					if(!exclusive){
+						out[i] = safe_int<T, Tpolicy>{static_cast<T>(sum)};
+					}
+				}
+			});
+	}
+	if(failing == chunks){
+		result.value = safe_int<T, Tpolicy>{static_cast<T>(offset)};
+	}
+	else{
+		result.value = sequential_scan(values, size * failing / chunks, size,
+				safe_int<T, Tpolicy>{static_cast<T>(offset)}, out, exclusive,
+				result.first_error, result.errors);
+	}
+	return result;
+}
+
+// without a wider type the partial sums of the chunks could overflow themselves:
+template<typename T, typename Tpolicy>
+reduce_result<T, Tpolicy> parallel_scan(const safe_int<T, Tpolicy>* values, std::size_t size,
+		safe_int<T, Tpolicy> init, safe_int<T, Tpolicy>* out, bool exclusive, unsigned,
+		std::false_type /* has wider type */){
+	reduce_result<T, Tpolicy> result{init, size, 0};
+	result.value = sequential_scan(values, 0, size, init, out, exclusive,
+			result.first_error, result.errors);
+	return result;
+}
+
+template<typename T, typename Tpolicy>
+reduce_result<T, Tpolicy> parallel_scan(const safe_int<T, Tpolicy>* values, std::size_t size,
+		safe_int<T, Tpolicy> init, safe_int<T, Tpolicy>* out, bool exclusive, unsigned threads){
+	return parallel_scan(values, size, init, out, exclusive, threads,
+		has_integer_type<2 * CHAR_BIT * sizeof(T), impl::is_signed<T>::value>{});
+}
+
+} // namespace impl
+
+/**
+ * @brief Sums the values on several threads.
+ *
+ * Every thread sums its part of the values in a wider type and records bounds
+ * for the smallest and largest partial sum, so that the sums before each part
+ * determine which part may contain the first partial sum that leaves the range
+ * of T. Everything from that part on is summed sequentially, so the result is the
+ * same as the one of a sequential fold with safe_int::operator+, including the
+ * calls of the policy. If the policy throws, the message contains the index of
+ * the failing element.
+ * Without a wider type than T (128 bit integers) the sum is computed sequentially.
+ *
+ * @param init the value the fold starts with
+ * @param threads the maximal number of threads; 0 uses the number of cores
+ */
+template<typename Tcontainer, typename Tvalue = typename Tcontainer::value_type>
+reduce_result<typename Tvalue::base_type, typename Tvalue::policy_type> parallel_reduce(
+		const Tcontainer& values, typename impl::identity<Tvalue>::type init = Tvalue{},
+		unsigned threads = 0){
+	const span<const Tvalue> view{values};
+	return impl::parallel_scan(view.data(), view.size(), init,
+			static_cast<Tvalue*>(nullptr), false, threads);
+}
+
+/**
+ * @brief Writes init + values[0] + ... + values[i] to out[i] for all i on several
+ *        threads.
+ *
+ * out may be the same as values but must not otherwise overlap with it; if an
+ * error occurs, out contains the values the sequential scan would have written.
+ * The result contains the final sum.
+ * @see parallel_reduce
+ * @throws std::length_error if the sizes of the spans differ
+ */
+template<typename T, typename Tpolicy>
+reduce_result<T, Tpolicy> parallel_inclusive_scan(
+		typename impl::identity<span<const safe_int<T, Tpolicy>>>::type values,
+		span<safe_int<T, Tpolicy>> out,
+		typename impl::identity<safe_int<T, Tpolicy>>::type init = safe_int<T, Tpolicy>{},
+		unsigned threads = 0){
+	if(values.size() != out.size()){
+		throw std::length_error{"spans of scan differ in size"};
+	}
+	return impl::parallel_scan(values.data(), values.size(), init, out.data(), false, threads);
+}
+
+/**
+ * @brief Writes init + values[0] + ... + values[i-1] to out[i] for all i on several
+ *        threads.
+ *
+ * Like a sequential exclusive scan, this adds the last value as well; the result
+ * contains the sum of init and all values.
+ * @see parallel_inclusive_scan
+ * @throws std::length_error if the sizes of the spans differ
+ */
+template<typename T, typename Tpolicy>
+reduce_result<T, Tpolicy> parallel_exclusive_scan(
+		typename impl::identity<span<const safe_int<T, Tpolicy>>>::type values,
+		span<safe_int<T, Tpolicy>> out,
+		typename impl::identity<safe_int<T, Tpolicy>>::type init = safe_int<T, Tpolicy>{},
+		unsigned threads = 0){
+	if(values.size() != out.size()){
+		throw std::length_error{"spans of scan differ in size"};
+	}
+	return impl::parallel_scan(values.data(), values.size(), init, out.data(), true, threads);
+}
+
+} // namespace type_builder
+
+#endif
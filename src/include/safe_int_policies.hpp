@@ -0,0 +1,138 @@
+#ifndef TYPE_BUILDER_SAFE_INT_POLICIES_HPP
+#define TYPE_BUILDER_SAFE_INT_POLICIES_HPP
+
+#include <cstdlib>
+#include <stdexcept>
+
+#include "policy_types.hpp"
+
+#if defined(__GNUC__)
+#	define TYPE_BUILDER_COLD __attribute__((noinline, cold))
+#else
+#	define TYPE_BUILDER_COLD
+#endif
+
+// gcc provides constexpr-usable predicates that only report whether an operation
+// would overflow; other compilers that know __builtin_*_overflow can use them in
+// constexpr-functions only since C++14. safe_int and the overflow-checks of
+// basic_number use them:
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 7
+#	define TYPE_BUILDER_HAS_OVERFLOW_PREDICATES
+#elif defined(__has_builtin)
+#	if __has_builtin(__builtin_add_overflow) && __cplusplus >= 201402L
+#		define TYPE_BUILDER_HAS_OVERFLOW_BUILTINS
+#	endif
+#endif
+
+namespace type_builder {
+
+// Every error-policy provides the static function
+//
+//   template<typename Texception, typename T>
+//   static T on_error(T saturated, T wrapped, const char* what);
+//
+// that is called by safe_int whenever an operation fails. Texception is the
+// exception that describes the error (std::overflow_error, std::underflow_error,
+// std::domain_error or std::out_of_range), saturated is the closest representable
+// value to the real result and wrapped is the result of the operation in
+// two's complement arithmetic. If the policy returns, the returned value is used as
+// the result of the operation.
+//
+// For divisions and modulo by zero there is no real result; the saturated value is
+// min, max or 0 for divisions (depending on the sign of the dividend) and the
+// dividend for modulo; the wrapped value is 0 for divisions and the dividend for
+// modulo. Invalid shifts result in 0.
+
+/**
+ * @brief Throws the exception that describes the error (default).
+ */
+struct throw_on_error{
+	template<typename Texception, typename T>
+	[[noreturn]] TYPE_BUILDER_COLD static T on_error(T, T, const char* what){
+		throw Texception{what};
+	}
+};
+
+/**
+ * @brief Clamps the result to the range of the type.
+ */
+struct saturate_on_error{
+	template<typename Texception, typename T>
+	constexpr static T on_error(T saturated, T, const char*){
+		return saturated;
+	}
+};
+
+/**
+ * @brief Uses the result of two's complement arithmetic.
+ */
+struct wrap_on_error{
+	template<typename Texception, typename T>
+	constexpr static T on_error(T, T wrapped, const char*){
+		return wrapped;
+	}
+};
+
+/**
+ * @brief Terminates the program abnormally without any exception-machinery.
+ */
+struct trap_on_error{
+	template<typename Texception, typename T>
+	[[noreturn]] TYPE_BUILDER_COLD static T on_error(T, T, const char*){
+#if defined(__GNUC__)
+		__builtin_trap();
+#else
+		std::abort();
+#endif
+	}
+};
+
+/**
+ * @brief Continues with the wrapped result but remembers that an error occurred.
+ *
+ * The flag is thread-local and sticky: it is set by the first failing operation
+ * and stays set until it is cleared, so that a whole batch of operations can be
+ * checked once at its end.
+ */
+struct poison_on_error{
+	template<typename Texception, typename T>
+	TYPE_BUILDER_COLD static T on_error(T, T wrapped, const char*){
+		flag() = true;
+		return wrapped;
+	}
+
+	/**
+	 * @brief Checks whether an operation in this thread failed since the last clear.
+	 */
+	static bool is_poisoned(){
+		return flag();
+	}
+
+	/**
+	 * @brief Resets the flag of this thread.
+	 */
+	static void clear(){
+		flag() = false;
+	}
+
+	/**
+	 * @brief Resets the flag and throws if it was set.
+	 * @throws std::range_error if an operation failed since the last clear.
+	 */
+	static void check(){
+		if(is_poisoned()){
+			clear();
+			throw std::range_error{"failed operation in poisoned safe_int-computation"};
+		}
+	}
+
+	private:
+		static bool& flag(){
+			static thread_local bool poisoned = false;
+			return poisoned;
+		}
+};
+
+} // namespace type_builder
+
+#endif
@@ -0,0 +1,191 @@
+#ifndef TYPE_BUILDER_SAFE_INT_RANGE_HPP
+#define TYPE_BUILDER_SAFE_INT_RANGE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include "safe_int.hpp"
+
+namespace type_builder {
+
+/**
+ * @brief The arithmetic progression first, first + stride, ... of count values of T,
+ *        which are all known to be in the range of T.
+ *
+ * The range is validated once when it is created, so that iterating it needs no
+ * checks and yields plain values of T; a loop over it can be vectorized by the
+ * compiler. Expressions of the values can be validated up front as well, see
+ * validate() and affine().
+ * Errors are handled by the policy; if it doesn't throw, the range is empty, so
+ * that a loop over it never sees a value that wasn't validated.
+ * @see checked_range
+ */
+template<typename T, typename Tpolicy = throw_on_error>
+class safe_int_range{
+	public:
+		typedef T value_type;
+		typedef Tpolicy policy_type;
+		typedef typename impl::make_unsigned<T>::type size_type;
+
+		class iterator{
+			T val;
+			T stride;
+			size_type index;
+
+			public:
+				typedef std::forward_iterator_tag iterator_category;
+				typedef T value_type;
+				typedef std::ptrdiff_t difference_type;
+				typedef const T* pointer;
+				typedef T reference;
+
+				constexpr iterator(): val{0}, stride{0}, index{0} {}
+				constexpr iterator(T value, T stride, size_type index):
+					val{value}, stride{stride}, index{index} {}
+
+				constexpr T operator*() const {
+					return val;
+				}
+
+				iterator& operator++(){
+					// the step behind the last value may leave the range of T:
+					val = impl::wrapping_add(val, stride);
+					++index;
+					return *this;
+				}
+
+				iterator operator++(int){
+					const iterator old{*this};
+					++*this;
+					return old;
+				}
+
+				friend constexpr bool operator==(const iterator& lhs, const iterator& rhs){
+					return lhs.index == rhs.index;
+				}
+				friend constexpr bool operator!=(const iterator& lhs, const iterator& rhs){
+					return lhs.index != rhs.index;
+				}
+		};
+
+	private:
+		T first_value;
+		// may have wrapped around for the images of affine maps; the values don't:
+		T stride;
+		size_type count;
+
+		constexpr safe_int_range(T first, T stride, size_type count):
+			first_value{first}, stride{stride}, count{count} {}
+
+		static size_type length(T begin, T end, T stride){
+			typedef size_type U;
+			return impl::is_negative(stride) ?
+				((begin > end) ?
+					static_cast<U>(static_cast<U>(static_cast<U>(begin) - static_cast<U>(end) - 1u)
+						/ static_cast<U>(U{0} - static_cast<U>(stride)) + 1u) : U{0}) :
+				((begin < end) ?
+					static_cast<U>(static_cast<U>(static_cast<U>(end) - static_cast<U>(begin) - 1u)
+						/ static_cast<U>(stride) + 1u) : U{0});
+		}
+
+		// scale * value + offset, if it is in the range of T:
+		static bool map_fails(T value, T scale, T offset){
+			return impl::mul_overflows(value, scale)
+				|| impl::add_overflows(static_cast<T>(value * scale), offset);
+		}
+
+	public:
+		constexpr safe_int_range(): first_value{0}, stride{1}, count{0} {}
+
+		/**
+		 * @brief The values from begin up to but excluding end in steps of stride,
+		 *        which may be negative; if end cannot be reached, the range is empty.
+		 */
+		safe_int_range(safe_int<T, Tpolicy> begin, safe_int<T, Tpolicy> end, safe_int<T, Tpolicy> stride):
+			first_value{begin.get_value()}, stride{stride.get_value()}, count{0} {
+			if(stride.get_value() == 0){
+				Tpolicy::template on_error<std::domain_error>(T{0}, T{0}, "stride of range is 0");
+				return;
+			}
+			count = length(begin.get_value(), end.get_value(), stride.get_value());
+		}
+
+		constexpr iterator begin() const {
+			return iterator{first_value, stride, 0};
+		}
+
+		constexpr iterator end() const {
+			return iterator{static_cast<T>(0), stride, count};
+		}
+
+		constexpr size_type size() const {
+			return count;
+		}
+
+		constexpr bool empty() const {
+			return count == 0;
+		}
+
+		constexpr T first() const {
+			return first_value;
+		}
+
+		/**
+		 * @brief Returns the last value; the range must not be empty.
+		 */
+		constexpr T last() const {
+			return static_cast<T>(static_cast<size_type>(first_value)
+				+ static_cast<size_type>(count - 1u) * static_cast<size_type>(stride));
+		}
+
+		/**
+		 * @brief Returns the range of scale * i + offset for all values i of this range.
+		 *
+		 * Since the map is monotonic, it suffices to check the first and the last
+		 * value; all values in between are in the range of T as well.
+		 */
+		safe_int_range affine(safe_int<T, Tpolicy> scale, safe_int<T, Tpolicy> offset) const {
+			const T s = scale.get_value();
+			const T o = offset.get_value();
+			if(empty()){
+				return safe_int_range{};
+			}
+			if(map_fails(first(), s, o) || map_fails(last(), s, o)){
+				Tpolicy::template on_error<std::overflow_error>(T{0}, T{0}, "affine map of range overflows");
+				return safe_int_range{};
+			}
+			return safe_int_range{static_cast<T>(first() * s + o), impl::wrapping_mul(stride, s), count};
+		}
+
+		/**
+		 * @brief Returns this range if scale * i + offset is in the range of T for all
+		 *        of its values i, so that the loop-body may compute it unchecked.
+		 */
+		safe_int_range validate(safe_int<T, Tpolicy> scale, safe_int<T, Tpolicy> offset = T{0}) const {
+			return (empty() || !affine(scale, offset).empty()) ? *this : safe_int_range{};
+		}
+};
+
+/**
+ * @brief Returns the range of values from begin up to but excluding end in steps of
+ *        stride.
+ * @see safe_int_range
+ */
+template<typename T, typename Tpolicy>
+safe_int_range<T, Tpolicy> checked_range(safe_int<T, Tpolicy> begin,
+		typename impl::identity<safe_int<T, Tpolicy>>::type end,
+		typename impl::identity<safe_int<T, Tpolicy>>::type stride = T{1}){
+	return safe_int_range<T, Tpolicy>{begin, end, stride};
+}
+
+template<typename T, typename = typename std::enable_if<impl::is_integer<T>::value>::type>
+safe_int_range<T> checked_range(T begin, typename impl::identity<T>::type end,
+		typename impl::identity<T>::type stride = T{1}){
+	return safe_int_range<T>{safe_int<T>{begin}, safe_int<T>{end}, safe_int<T>{stride}};
+}
+
+} // namespace type_builder
+
+#endif
@@ -0,0 +1,251 @@
+#ifndef TYPE_BUILDER_SHARDED_COUNTER_HPP
+#define TYPE_BUILDER_SHARDED_COUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "basic_number_core.hpp"
+#include "safe_accumulator.hpp"
+#include "safe_int.hpp"
+
+namespace type_builder {
+
+namespace impl{
+
+/**
+ * @brief How a sharded_counter counts numbers of type Tnumber.
+ *
+ * value_type is the integer that the numbers hold and policy_type the policy that
+ * checks their sum, or void if it wraps around: numbers of a safe_int are checked
+ * with the policy of it, numbers with ENABLE_OVERFLOW_CHECK with the one of their
+ * flags.
+ */
+template<typename Tnumber>
+struct counter_traits;
+
+template<typename T, class Tid, flag_t Tflags, template<typename, class> class Tbase>
+struct counter_traits<basic_number<T, Tid, Tflags, Tbase>>{
+	typedef T value_type;
+	typedef typename std::conditional<(Tflags & ENABLE_OVERFLOW_CHECK) != 0,
+		typename overflow_policy<Tflags>::type, void>::type policy_type;
+	static constexpr flag_t flags = Tflags;
+
+	static T value(const basic_number<T, Tid, Tflags, Tbase>& number){
+		return number.get_value();
+	}
+
+	static basic_number<T, Tid, Tflags, Tbase> make(T value){
+		return basic_number<T, Tid, Tflags, Tbase>{value};
+	}
+};
+
+template<typename T, typename Tpolicy, class Tid, flag_t Tflags, template<typename, class> class Tbase>
+struct counter_traits<basic_number<safe_int<T, Tpolicy>, Tid, Tflags, Tbase>>{
+	typedef T value_type;
+	typedef Tpolicy policy_type;
+	static constexpr flag_t flags = Tflags;
+
+	static T value(const basic_number<safe_int<T, Tpolicy>, Tid, Tflags, Tbase>& number){
+		return number.get_value().get_value();
+	}
+
+	static basic_number<safe_int<T, Tpolicy>, Tid, Tflags, Tbase> make(T value){
+		return basic_number<safe_int<T, Tpolicy>, Tid, Tflags, Tbase>{safe_int<T, Tpolicy>{value}};
+	}
+};
+
+/**
+ * @brief The index of the calling thread, which it gets on its first call, so that
+ *        consecutive threads use different shards.
+ */
+inline std::size_t thread_index() noexcept{
+	static std::atomic<std::size_t> next{0};
+	static thread_local std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+	return index;
+}
+
+} // namespace impl
+
+/**
+ * @brief A counter of basic_numbers of integers, that many threads change at the
+ *        same time without contending for a single cache-line.
+ *
+ * Every thread adds to a shard of its own, with relaxed atomic operations; threads
+ * only share shards if there are more of them than shards. The shards are two
+ * cache-lines apart, since x86 prefetches lines in pairs. Every shard counts what
+ * was added and what was subtracted separately, in two unsigned 64-bit integers, so
+ * that a thread that only subtracts doesn't wrap it around; negative amounts count
+ * on the other side. Each side wraps around at 2^64, which only the amounts of
+ * 64-bit numbers can practically reach.
+ *
+ * load() sums up the shards. The sum contains everything that was added before the
+ * call, but it is no snapshot: additions of other threads at the same time may or
+ * may not be part of it. If the numbers hold safe_ints or have
+ * ENABLE_OVERFLOW_CHECK, both sides are summed in registers of twice their width
+ * like in safe_accumulator and only their difference has to fit into the number;
+ * otherwise it wraps around.
+ *
+ * add() and subtract() need ENABLE_SPECIFIC_PLUS_MINUS, increment() and decrement()
+ * ENABLE_INC_DEC, like the operators of the numbers.
+ *
+ * @param Tnumber a basic_number of an integer or of a safe_int
+ */
+template<typename Tnumber>
+class sharded_counter{
+	typedef impl::counter_traits<Tnumber> traits;
+	typedef typename traits::value_type T;
+	typedef typename traits::policy_type Tpolicy;
+
+	static_assert(impl::is_checked_integer<T>::value && sizeof(T) <= 8,
+			"sharded_counter needs numbers of integers with at most 64 bits");
+
+	typedef std::uint64_t shard_type;
+
+	static constexpr std::size_t stride = 128 / sizeof(shard_type);
+
+	std::size_t mask;
+	// (shards + 1) * stride cells, of which those from the first one that starts a
+	// cache-line on, every stride-th, are the shards; the cell after each of them
+	// holds the subtractions:
+	std::vector<std::atomic<shard_type>> cells;
+	std::atomic<shard_type>* first;
+
+	std::atomic<shard_type>* shard() noexcept{
+		return first + (impl::thread_index() & mask) * stride;
+	}
+
+	void count(T value, bool subtract) noexcept{
+		const bool negative = impl::is_negative(value);
+		const shard_type magnitude = negative ?
+			shard_type{0} - static_cast<shard_type>(value) : static_cast<shard_type>(value);
+		shard()[negative != subtract].fetch_add(magnitude, std::memory_order_relaxed);
+	}
+
+	static std::size_t round_shards(std::size_t shards){
+		if(shards == 0){
+			shards = std::thread::hardware_concurrency();
+		}
+		std::size_t count = 1;
+		while(count < shards){
+			count *= 2;
+		}
+		return count;
+	}
+
+	static std::atomic<shard_type>* first_shard(std::atomic<shard_type>* cells){
+		const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(cells);
+		return cells + (64 - address % 64) % 64 / sizeof(shard_type);
+	}
+
+	Tnumber aggregate(std::false_type) const noexcept{
+		shard_type sum = 0;
+		for(std::size_t i = 0; i <= mask; ++i){
+			sum += first[i * stride].load(std::memory_order_relaxed);
+			sum -= first[i * stride + 1].load(std::memory_order_relaxed);
+		}
+		return traits::make(static_cast<T>(sum));
+	}
+
+	Tnumber aggregate(std::true_type) const{
+		typedef impl::deferred_sum<shard_type, Tpolicy> sum_type;
+		typedef typename sum_type::register_type register_type;
+		sum_type added;
+		sum_type subtracted;
+		for(std::size_t i = 0; i <= mask; ++i){
+			added.add(first[i * stride].load(std::memory_order_relaxed));
+			subtracted.add(first[i * stride + 1].load(std::memory_order_relaxed));
+		}
+		const register_type up = added.value();
+		const register_type down = subtracted.value();
+		const T wrapped = static_cast<T>(static_cast<shard_type>(up - down));
+		if(up >= down){
+			return traits::make(impl::above_range<T>(static_cast<register_type>(up - down)) ?
+				Tpolicy::template on_error<std::overflow_error>(
+					std::numeric_limits<T>::max(), wrapped, "overflow in sum") :
+				wrapped);
+		}
+		// a negative sum fits if its magnitude is at most max + 1:
+		return traits::make((!impl::is_signed<T>::value ||
+				static_cast<register_type>(down - up - 1) >
+					static_cast<register_type>(std::numeric_limits<T>::max())) ?
+			Tpolicy::template on_error<std::underflow_error>(
+				std::numeric_limits<T>::min(), wrapped, "underflow in sum") :
+			wrapped);
+	}
+
+	typedef std::integral_constant<bool, !std::is_void<Tpolicy>::value> checked;
+
+	public:
+		typedef Tnumber value_type;
+
+		/**
+		 * @param shards the number of shards, which is rounded up to a power of two;
+		 *        0 uses the number of cores
+		 */
+		explicit sharded_counter(std::size_t shards = 0):
+			mask{round_shards(shards) - 1},
+			cells((mask + 2) * stride),
+			first{first_shard(cells.data())}{
+			reset();
+		}
+
+		sharded_counter(const sharded_counter&) = delete;
+		sharded_counter& operator=(const sharded_counter&) = delete;
+
+		std::size_t shards() const noexcept{
+			return mask + 1;
+		}
+
+		void add(const Tnumber& amount) noexcept{
+			static_assert((traits::flags & ENABLE_SPECIFIC_PLUS_MINUS) != 0,
+					"addition not enabled for this number-type");
+			count(traits::value(amount), false);
+		}
+
+		void subtract(const Tnumber& amount) noexcept{
+			static_assert((traits::flags & ENABLE_SPECIFIC_PLUS_MINUS) != 0,
+					"subtraction not enabled for this number-type");
+			count(traits::value(amount), true);
+		}
+
+		void increment() noexcept{
+			static_assert((traits::flags & ENABLE_INC_DEC) != 0,
+					"increment not enabled for this number-type");
+			shard()[0].fetch_add(1, std::memory_order_relaxed);
+		}
+
+		void decrement() noexcept{
+			static_assert((traits::flags & ENABLE_INC_DEC) != 0,
+					"increment not enabled for this number-type");
+			shard()[1].fetch_add(1, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Returns the sum of the shards.
+		 * @throws std::overflow_error or std::underflow_error if the sum doesn't fit
+		 *         into the number and the policy of it throws
+		 */
+		Tnumber load() const noexcept(!checked::value){
+			return aggregate(checked{});
+		}
+
+		/**
+		 * @brief Sets the counter to zero; additions at the same time may be lost.
+		 */
+		void reset() noexcept{
+			for(std::size_t i = 0; i <= mask; ++i){
+				first[i * stride].store(0, std::memory_order_relaxed);
+				first[i * stride + 1].store(0, std::memory_order_relaxed);
+			}
+		}
+};
+
+} // namespace type_builder
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef TYPE_BUILDER_SPAN_HPP
+#define TYPE_BUILDER_SPAN_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace type_builder {
+
+/**
+ * @brief A non-owning view of a contiguous sequence of T.
+ *
+ * This is a minimal replacement for std::span, which is not available in C++11.
+ * It can be created from a pointer and a size, from an array or from any
+ * container that provides data() and size().
+ */
+template<typename T>
+class span{
+	T* ptr;
+	std::size_t len;
+
+	public:
+		typedef T element_type;
+		typedef typename std::remove_cv<T>::type value_type;
+		typedef T* iterator;
+
+		constexpr span(): ptr{nullptr}, len{0} {}
+
+		constexpr span(T* data, std::size_t size): ptr{data}, len{size} {}
+
+		template<std::size_t N>
+		constexpr span(T (&array)[N]): ptr{array}, len{N} {}
+
+		template<typename Tcontainer, typename = typename std::enable_if<
+			!std::is_array<typename std::remove_reference<Tcontainer>::type>::value &&
+			std::is_convertible<decltype(std::declval<Tcontainer&>().data()), T*>::value
+			>::type>
+		constexpr span(Tcontainer& container): ptr{container.data()}, len{container.size()} {}
+
+		template<typename Tcontainer, typename = typename std::enable_if<
+			!std::is_array<Tcontainer>::value &&
+			std::is_convertible<decltype(std::declval<const Tcontainer&>().data()), T*>::value
+			>::type>
+		constexpr span(const Tcontainer& container): ptr{container.data()}, len{container.size()} {}
+
+		template<typename Tother, typename = typename std::enable_if<
+			std::is_convertible<Tother(*)[], T(*)[]>::value>::type>
+		constexpr span(const span<Tother>& other): ptr{other.data()}, len{other.size()} {}
+
+		constexpr T* data() const {
+			return ptr;
+		}
+
+		constexpr std::size_t size() const {
+			return len;
+		}
+
+		constexpr bool empty() const {
+			return len == 0;
+		}
+
+		constexpr T& operator[](std::size_t index) const {
+			return ptr[index];
+		}
+
+		constexpr iterator begin() const {
+			return ptr;
+		}
+
+		constexpr iterator end() const {
+			return ptr + len;
+		}
+
+		/**
+		 * @brief Returns the view of count elements, starting at offset.
+		 */
+		constexpr span subspan(std::size_t offset, std::size_t count) const {
+			return span{ptr + offset, count};
+		}
+};
+
+template<typename T>
+constexpr span<T> make_span(T* data, std::size_t size){
+	return span<T>{data, size};
+}
+
+template<typename Tcontainer>
+constexpr auto make_span(Tcontainer& container)
+-> span<typename std::remove_pointer<decltype(container.data())>::type>
+{
+	return {container.data(), container.size()};
+}
+
+} // namespace type_builder
+
+#endif
@@ -0,0 +1,54 @@
+// The module-interface of type_builder for C++20:
+//
+//   import type_builder;
+//
+// exports the same declarations as the headers below, which are only parsed once
+// when the module is compiled instead of in every translation unit that uses them.
+// The standard-library is included in the global module fragment, so that it is not
+// attached to this module; programs that import it include what they use of it
+// themselves, as usual.
+//
+// promoting_int.hpp and sharded_counter.hpp are not part of the module yet, since
+// g++ 12 fails to write modules with thread_local variables that have a destructor
+// and drops the thread_local of those without one; they can still be included
+// next to the import.
+module;
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iosfwd>
+#include <iterator>
+#include <limits>
+#include <ratio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+export module type_builder;
+
+export {
+#include "basic_number.hpp"
+#include "basic_number_atomic.hpp"
+#include "basic_number_hash.hpp"
+#include "basic_number_overflow.hpp"
+#include "bounded.hpp"
+#include "flat_map.hpp"
+#include "safe_accumulator.hpp"
+#include "safe_int.hpp"
+#include "safe_int_batch.hpp"
+#include "safe_int_constant.hpp"
+#include "safe_int_divisor.hpp"
+#include "safe_int_parallel.hpp"
+#include "safe_int_range.hpp"
+#include "widening_safe_int.hpp"
+}
@@ -0,0 +1,212 @@
+#ifndef TYPE_BUILDER_WIDENING_SAFE_INT_HPP
+#define TYPE_BUILDER_WIDENING_SAFE_INT_HPP
+
+#include <type_traits>
+#include <climits>
+#include <iosfwd>
+
+#include "safe_int.hpp"
+
+namespace type_builder {
+
+template<typename T, typename Tpolicy = throw_on_error> class widening_safe_int;
+
+namespace impl{
+
+/**
+ * @brief Provides the result of +, - and * on widening_safe_ints.
+ *
+ * The result has twice as many bits as the larger operand, which is enough to hold
+ * every possible result, so the operations need no checks. It is signed if any of
+ * the operands is or if Tforce_signed is set (for subtractions).
+ * If there is no such type, the largest type is used and the operations are checked
+ * like the ones of safe_int.
+ */
+template<typename Tlhs, typename Trhs, bool Tforce_signed, typename Tpolicy,
+	int Tsize = 2 * CHAR_BIT * (sizeof(Tlhs) > sizeof(Trhs) ? sizeof(Tlhs) : sizeof(Trhs)),
+	bool Tsigned = Tforce_signed || impl::is_signed<Tlhs>::value || impl::is_signed<Trhs>::value,
+	bool Texists = has_integer_type<Tsize, Tsigned>::value>
+struct widened{
+	typedef typename integer_type<Tsize, Tsigned>::type base_type;
+	typedef widening_safe_int<base_type, Tpolicy> type;
+
+	constexpr static type add(Tlhs lhs, Trhs rhs){
+		return type{static_cast<base_type>(static_cast<base_type>(lhs) + static_cast<base_type>(rhs))};
+	}
+	constexpr static type sub(Tlhs lhs, Trhs rhs){
+		return type{static_cast<base_type>(static_cast<base_type>(lhs) - static_cast<base_type>(rhs))};
+	}
+	constexpr static type mul(Tlhs lhs, Trhs rhs){
+		return type{static_cast<base_type>(static_cast<base_type>(lhs) * static_cast<base_type>(rhs))};
+	}
+};
+
+template<typename Tlhs, typename Trhs, bool Tforce_signed, typename Tpolicy, int Tsize, bool Tsigned>
+struct widened<Tlhs, Trhs, Tforce_signed, Tpolicy, Tsize, Tsigned, false>{
+	typedef typename integer_type<Tsize / 2, Tsigned>::type base_type;
+	typedef widening_safe_int<base_type, Tpolicy> type;
+	typedef safe_int<base_type, Tpolicy> checked_type;
+
+	constexpr static type add(Tlhs lhs, Trhs rhs){
+		return type{(checked_type{lhs} + checked_type{rhs}).get_value()};
+	}
+	constexpr static type sub(Tlhs lhs, Trhs rhs){
+		return type{(checked_type{lhs} - checked_type{rhs}).get_value()};
+	}
+	constexpr static type mul(Tlhs lhs, Trhs rhs){
+		return type{(checked_type{lhs} * checked_type{rhs}).get_value()};
+	}
+};
+
+} // namespace impl
+
+/**
+ * @brief An integer whose arithmetic widens the result instead of checking it.
+ *
+ * +, - and * return a widening_safe_int with twice as many bits as the larger operand,
+ * so none of them can overflow and no check is necessary. The only check is done
+ * when the result is explicitly narrowed back into a smaller type with narrow() or
+ * an explicit conversion, which moves the checks out of the computation to a single
+ * point at its end. Only operations whose result would need more than the largest
+ * supported integer-type are checked.
+ */
+template<typename T, typename Tpolicy>
+class widening_safe_int{
+	static_assert(impl::is_integer<T>::value, "widening_safe_int holds only integral types");
+	T val;
+
+	public:
+		typedef T base_type;
+		typedef Tpolicy policy_type;
+
+		constexpr widening_safe_int(): val{0}{}
+
+		//non-explicit constructor because we want to have implicit conversions
+		constexpr widening_safe_int(T val): val{val}{}
+
+		constexpr widening_safe_int(const safe_int<T, Tpolicy>& value): val{value.get_value()}{}
+
+		constexpr widening_safe_int(const widening_safe_int&) = default;
+
+		// checked narrowing from any other integer:
+		template<typename Targ,
+			typename = typename std::enable_if<impl::is_integer<Targ>::value>::type>
+		constexpr explicit widening_safe_int(const Targ& value):
+			val{safe_int<T, Tpolicy>{value}.get_value()}{}
+
+		template<typename Targ>
+		constexpr explicit widening_safe_int(const widening_safe_int<Targ, Tpolicy>& value):
+			val{safe_int<T, Tpolicy>{value.get_value()}.get_value()}{}
+
+		widening_safe_int& operator=(const widening_safe_int&) = default;
+
+		/**
+		 * @brief Converts the value into a smaller safe_int; this is checked.
+		 */
+		template<typename Ttarget>
+		constexpr safe_int<Ttarget, Tpolicy> narrow() const {
+			return safe_int<Ttarget, Tpolicy>{val};
+		}
+
+		template<typename Ttarget>
+		constexpr explicit operator safe_int<Ttarget, Tpolicy>() const {
+			return narrow<Ttarget>();
+		}
+
+		constexpr safe_int<T, Tpolicy> to_safe_int() const {
+			return safe_int<T, Tpolicy>{val};
+		}
+
+		constexpr base_type get_value() const {
+			return val;
+		}
+
+		constexpr widening_safe_int operator+() const {
+			return *this;
+		}
+};
+
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+constexpr auto operator+(const widening_safe_int<Tlhs, Tpolicy>& lhs, const widening_safe_int<Trhs, Tpolicy>& rhs)
+-> typename impl::widened<Tlhs, Trhs, false, Tpolicy>::type
+{
+	return impl::widened<Tlhs, Trhs, false, Tpolicy>::add(lhs.get_value(), rhs.get_value());
+}
+
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+constexpr auto operator-(const widening_safe_int<Tlhs, Tpolicy>& lhs, const widening_safe_int<Trhs, Tpolicy>& rhs)
+-> typename impl::widened<Tlhs, Trhs, true, Tpolicy>::type
+{
+	return impl::widened<Tlhs, Trhs, true, Tpolicy>::sub(lhs.get_value(), rhs.get_value());
+}
+
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+constexpr auto operator*(const widening_safe_int<Tlhs, Tpolicy>& lhs, const widening_safe_int<Trhs, Tpolicy>& rhs)
+-> typename impl::widened<Tlhs, Trhs, false, Tpolicy>::type
+{
+	return impl::widened<Tlhs, Trhs, false, Tpolicy>::mul(lhs.get_value(), rhs.get_value());
+}
+
+template<typename T, typename Tpolicy>
+constexpr auto operator-(const widening_safe_int<T, Tpolicy>& value)
+-> typename impl::widened<T, T, true, Tpolicy>::type
+{
+	return impl::widened<T, T, true, Tpolicy>::sub(T{0}, value.get_value());
+}
+
+// division and modulo cannot grow the result, so they are done like in safe_int:
+
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+constexpr auto operator/(const widening_safe_int<Tlhs, Tpolicy>& lhs, const widening_safe_int<Trhs, Tpolicy>& rhs)
+-> widening_safe_int<typename impl::shared_type<Tlhs, Trhs>::type, Tpolicy>
+{
+	return lhs.to_safe_int() / rhs.to_safe_int();
+}
+
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+constexpr auto operator%(const widening_safe_int<Tlhs, Tpolicy>& lhs, const widening_safe_int<Trhs, Tpolicy>& rhs)
+-> widening_safe_int<typename impl::shared_type<Tlhs, Trhs>::type, Tpolicy>
+{
+	return lhs.to_safe_int() % rhs.to_safe_int();
+}
+
+// comparisions:
+
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+constexpr bool operator==(const widening_safe_int<Tlhs, Tpolicy>& lhs, const widening_safe_int<Trhs, Tpolicy>& rhs){
+	return lhs.to_safe_int() == rhs.to_safe_int();
+}
+
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+constexpr bool operator!=(const widening_safe_int<Tlhs, Tpolicy>& lhs, const widening_safe_int<Trhs, Tpolicy>& rhs){
+	return lhs.to_safe_int() != rhs.to_safe_int();
+}
+
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+bool operator<(const widening_safe_int<Tlhs, Tpolicy>& lhs, const widening_safe_int<Trhs, Tpolicy>& rhs){
+	return lhs.to_safe_int() < rhs.to_safe_int();
+}
+
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+bool operator<=(const widening_safe_int<Tlhs, Tpolicy>& lhs, const widening_safe_int<Trhs, Tpolicy>& rhs){
+	return lhs.to_safe_int() <= rhs.to_safe_int();
+}
+
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+bool operator>(const widening_safe_int<Tlhs, Tpolicy>& lhs, const widening_safe_int<Trhs, Tpolicy>& rhs){
+	return lhs.to_safe_int() > rhs.to_safe_int();
+}
+
+template<typename Tlhs, typename Trhs, typename Tpolicy>
+bool operator>=(const widening_safe_int<Tlhs, Tpolicy>& lhs, const widening_safe_int<Trhs, Tpolicy>& rhs){
+	return lhs.to_safe_int() >= rhs.to_safe_int();
+}
+
+template<typename Tchar, typename T, typename Tpolicy>
+std::basic_ostream<Tchar>& operator<<(std::basic_ostream<Tchar>& stream, const widening_safe_int<T, Tpolicy>& value){
+	return (stream << value.get_value());
+}
+
+} // namespace type_builder
+
+#endif
@@ -0,0 +1,9 @@
+// The explicit instantiations for programs that are compiled with
+// TYPE_BUILDER_EXTERN_TEMPLATES, see the end of safe_int.hpp.
+#include "../include/safe_int.hpp"
+
+namespace type_builder {
+
+TYPE_BUILDER_SAFE_INT_INSTANTIATIONS()
+
+} // namespace type_builder
@@ -0,0 +1,163 @@
+#include "../include/basic_number.hpp"
+#include "../include/basic_number_atomic.hpp"
+#include "../include/basic_number_overflow.hpp"
+#include "../include/safe_int.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+struct sequence_t{};
+using sequence = type_builder::basic_number<std::uint64_t, sequence_t,
+	type_builder::ENABLE_SPECIFIC_EQUALITY_CHECK | type_builder::ENABLE_INC_DEC>;
+
+struct counter_t{};
+using counter = type_builder::basic_number<std::int64_t, counter_t, type_builder::DEFAULT_SETTINGS>;
+
+struct checked_t{};
+using checked = type_builder::basic_number<std::int8_t, checked_t,
+	type_builder::DEFAULT_SETTINGS | type_builder::ENABLE_OVERFLOW_CHECK>;
+using saturated = type_builder::basic_number<std::int8_t, checked_t,
+	type_builder::DEFAULT_SETTINGS | type_builder::ENABLE_SATURATING_OVERFLOW_CHECK>;
+
+struct nested_t{};
+using nested = type_builder::basic_number<type_builder::safe_int<std::int32_t>, nested_t,
+	type_builder::DEFAULT_SETTINGS>;
+
+struct length_t{};
+using length = type_builder::basic_number<double, length_t, type_builder::DEFAULT_SETTINGS>;
+
+// whether atomic<T>::fetch_add exists:
+template<typename T, typename = void>
+struct has_fetch_add: std::false_type{};
+
+template<typename T>
+struct has_fetch_add<T, decltype(void(std::declval<std::atomic<T>&>().fetch_add(std::declval<T>())))>:
+	std::true_type{};
+
+static_assert(sizeof(std::atomic<counter>) == sizeof(std::atomic<std::int64_t>), "");
+static_assert(!has_fetch_add<sequence>::value, "fetch_add needs ENABLE_SPECIFIC_PLUS_MINUS");
+static_assert(has_fetch_add<counter>::value, "");
+static_assert(has_fetch_add<nested>::value, "");
+static_assert(std::is_same<std::atomic<counter>::value_type, counter>::value, "");
+#if defined(__cpp_lib_atomic_is_always_lock_free)
+static_assert(std::atomic<counter>::is_always_lock_free == std::atomic<std::int64_t>::is_always_lock_free, "");
+#endif
+
+template<typename Tatomic, typename Tfunction>
+static void on_threads(Tatomic& atomic, unsigned count, Tfunction function){
+	std::vector<std::thread> threads;
+	for(unsigned i = 0; i < count; ++i){
+		threads.emplace_back([&atomic, function]{
+			function(atomic);
+		});
+	}
+	for(auto& thread: threads){
+		thread.join();
+	}
+}
+
+int main(){
+	std::atomic<counter> total{counter{10}};
+	assert(total.is_lock_free() == std::atomic<std::int64_t>{}.is_lock_free());
+	assert(total.load() == counter{10});
+	assert(total.fetch_add(counter{5}, std::memory_order_relaxed) == counter{10});
+	assert(total.fetch_sub(counter{3}) == counter{15});
+	assert((total += counter{8}) == counter{20});
+	assert((total -= counter{20}) == counter{0});
+	total.store(counter{-4}, std::memory_order_release);
+	assert(total.exchange(counter{7}, std::memory_order_acq_rel) == counter{-4});
+	counter expected{6};
+	assert(!total.compare_exchange_strong(expected, counter{1}));
+	assert(expected == counter{7});
+	assert(total.compare_exchange_strong(expected, counter{1},
+		std::memory_order_acq_rel, std::memory_order_acquire));
+	const counter loaded = total;
+	assert(loaded == counter{1});
+	assert(total.fetch_update([](counter value){ return value * 10; }) == counter{1});
+	assert(total.load(std::memory_order_acquire) == counter{10});
+
+	std::atomic<sequence> next{sequence{0}};
+	assert(++next == sequence{1});
+	assert(next++ == sequence{1});
+	assert(next-- == sequence{2});
+	assert(--next == sequence{0});
+	next = sequence{41};
+	assert(++next == sequence{42});
+
+	// the checked operations throw and leave the value as it was:
+	std::atomic<checked> small{checked{std::int8_t{120}}};
+	assert(small.fetch_add(checked{std::int8_t{7}}) == checked{std::int8_t{120}});
+	bool thrown = false;
+	try{
+		small += checked{std::int8_t{1}};
+	}
+	catch(std::overflow_error&){
+		thrown = true;
+	}
+	assert(thrown && small.load() == checked{std::int8_t{127}});
+	assert(small.fetch_sub(checked{std::int8_t{127}}) == checked{std::int8_t{127}});
+	thrown = false;
+	try{
+		small.fetch_sub(checked{std::numeric_limits<std::int8_t>::min()});
+	}
+	catch(std::overflow_error&){
+		thrown = true;
+	}
+	assert(thrown && small.load() == checked{std::int8_t{0}});
+
+	std::atomic<saturated> clamped{saturated{std::int8_t{100}}};
+	assert((clamped += saturated{std::int8_t{100}}) == saturated{std::int8_t{127}});
+	assert(clamped.load() == saturated{std::int8_t{127}});
+
+	std::atomic<nested> safe{nested{type_builder::safe_int<std::int32_t>{std::numeric_limits<std::int32_t>::max()}}};
+	thrown = false;
+	try{
+		safe.fetch_add(nested{type_builder::safe_int<std::int32_t>{1}});
+	}
+	catch(std::overflow_error&){
+		thrown = true;
+	}
+	assert(thrown);
+	assert(safe.load().get_value().get_value() == std::numeric_limits<std::int32_t>::max());
+
+	std::atomic<length> distance{length{0.5}};
+	assert((distance += length{0.25}) == length{0.75});
+
+	// concurrent updates are neither lost nor torn:
+	const unsigned threads = 4;
+	const int iterations = 100000;
+	std::atomic<counter> shared{counter{0}};
+	on_threads(shared, threads, [](std::atomic<counter>& value){
+		for(int i = 0; i < iterations; ++i){
+			value.fetch_add(counter{1}, std::memory_order_relaxed);
+		}
+	});
+	assert(shared.load() == counter{std::int64_t{threads} * iterations});
+
+	std::atomic<sequence> ids{sequence{0}};
+	on_threads(ids, threads, [](std::atomic<sequence>& value){
+		for(int i = 0; i < iterations; ++i){
+			++value;
+		}
+	});
+	assert(ids.load() == sequence{std::uint64_t{threads} * iterations});
+
+	std::atomic<nested> checked_sum{nested{type_builder::safe_int<std::int32_t>{0}}};
+	on_threads(checked_sum, threads, [](std::atomic<nested>& value){
+		for(int i = 0; i < iterations; ++i){
+			value.fetch_add(nested{type_builder::safe_int<std::int32_t>{2}}, std::memory_order_relaxed);
+		}
+	});
+	assert(checked_sum.load().get_value().get_value() == 2 * static_cast<std::int32_t>(threads) * iterations);
+}
@@ -0,0 +1,101 @@
+#include "../include/basic_number.hpp"
+#include "../include/basic_number_hash.hpp"
+#include "../include/safe_int.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+struct user_id_t{};
+using user_id = type_builder::basic_number<int, user_id_t, type_builder::ENABLE_SPECIFIC_EQUALITY_CHECK>;
+
+struct length_t{};
+using length = type_builder::basic_number<double, length_t, type_builder::DEFAULT_SETTINGS>;
+
+using I64 = type_builder::safe_int<std::int64_t>;
+using W8 = type_builder::safe_int<std::uint8_t, type_builder::wrap_on_error>;
+
+struct checked_id_t{};
+using checked_id = type_builder::basic_number<I64, checked_id_t, type_builder::ENABLE_SPECIFIC_EQUALITY_CHECK>;
+
+// a value without a hash:
+struct opaque{
+	int value;
+};
+struct opaque_number_t{};
+using opaque_number = type_builder::basic_number<opaque, opaque_number_t>;
+
+// the limits are those of the values:
+static_assert(std::numeric_limits<user_id>::is_specialized, "");
+static_assert(std::numeric_limits<user_id>::max().get_value() == std::numeric_limits<int>::max(), "");
+static_assert(std::numeric_limits<user_id>::min().get_value() == std::numeric_limits<int>::min(), "");
+static_assert(std::is_same<decltype(std::numeric_limits<user_id>::max()), user_id>::value, "");
+static_assert(std::numeric_limits<user_id>::digits == 31, "");
+static_assert(std::numeric_limits<const user_id>::max().get_value() == std::numeric_limits<int>::max(), "");
+static_assert(std::numeric_limits<length>::has_infinity, "");
+static_assert(std::numeric_limits<length>::epsilon().get_value() == std::numeric_limits<double>::epsilon(), "");
+static_assert(std::numeric_limits<checked_id>::max().get_value().get_value()
+	== std::numeric_limits<std::int64_t>::max(), "");
+static_assert(!std::numeric_limits<opaque_number>::is_specialized, "");
+
+static_assert(std::numeric_limits<I64>::is_specialized, "");
+static_assert(std::numeric_limits<I64>::lowest().get_value() == std::numeric_limits<std::int64_t>::lowest(), "");
+static_assert(std::is_same<decltype(std::numeric_limits<I64>::max()), I64>::value, "");
+// safe_int doesn't wrap around unless its policy does:
+static_assert(!std::numeric_limits<type_builder::safe_int<unsigned>>::is_modulo, "");
+static_assert(std::numeric_limits<W8>::is_modulo, "");
+
+// the hashes are enabled exactly if the values can be hashed:
+static_assert(std::is_default_constructible<std::hash<user_id>>::value, "");
+static_assert(std::is_default_constructible<std::hash<checked_id>>::value, "");
+static_assert(!std::is_default_constructible<std::hash<opaque_number>>::value, "");
+
+#if defined(TYPE_BUILDER_HAS_INT128)
+// the standard-library may neither hash nor know the limits of the 128 bit integers
+// in strict ISO-mode:
+using I128 = type_builder::safe_int<type_builder::int128_t>;
+using U128 = type_builder::safe_int<type_builder::uint128_t>;
+static_assert(std::is_default_constructible<std::hash<I128>>::value
+	== std::is_default_constructible<std::hash<type_builder::int128_t>>::value, "");
+static_assert(std::numeric_limits<I128>::is_specialized, "");
+static_assert(std::numeric_limits<I128>::max().get_value()
+	== static_cast<type_builder::int128_t>(~type_builder::uint128_t{0} >> 1), "");
+static_assert(std::numeric_limits<U128>::max().get_value() == ~type_builder::uint128_t{0}, "");
+using int128_limits = type_builder::impl::integer_limits<type_builder::int128_t, false>;
+static_assert(int128_limits::max() == std::numeric_limits<I128>::max().get_value(), "");
+static_assert(int128_limits::min() == std::numeric_limits<I128>::min().get_value(), "");
+static_assert(int128_limits::digits == 127 && int128_limits::digits10 == 38, "");
+static_assert(!int128_limits::is_modulo && int128_limits::is_signed, "");
+using uint128_limits = type_builder::impl::integer_limits<type_builder::uint128_t, false>;
+static_assert(uint128_limits::max() == ~type_builder::uint128_t{0} && uint128_limits::min() == 0, "");
+static_assert(uint128_limits::digits == 128 && uint128_limits::digits10 == 38, "");
+#endif
+
+int main(){
+	assert(std::hash<user_id>{}(user_id{42}) == std::hash<int>{}(42));
+	assert(std::hash<length>{}(length{1.5}) == std::hash<double>{}(1.5));
+	assert(std::hash<I64>{}(I64{-7}) == std::hash<std::int64_t>{}(-7));
+	assert(std::hash<checked_id>{}(checked_id{I64{-7}}) == std::hash<std::int64_t>{}(-7));
+	assert(std::hash<I64>{}(std::numeric_limits<I64>::max())
+		== std::hash<std::int64_t>{}(std::numeric_limits<std::int64_t>::max()));
+
+	// numbers are keys of the unordered containers without a hasher of their own:
+	std::unordered_map<user_id, std::string> names;
+	names[user_id{1}] = "one";
+	names[user_id{2}] = "two";
+	assert(names.at(user_id{1}) == "one");
+	assert(names.count(user_id{3}) == 0);
+	std::unordered_set<checked_id> ids{checked_id{I64{1}}, checked_id{I64{2}}, checked_id{I64{1}}};
+	assert(ids.size() == 2);
+	std::unordered_set<I64> values{I64{5}, I64{6}};
+	assert(values.count(I64{5}) == 1);
+}
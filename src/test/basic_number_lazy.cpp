@@ -0,0 +1,112 @@
+#include "../include/basic_number.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+// a heavy underlying type that counts how often it is copied:
+struct vector3{
+	static std::size_t copies;
+
+	std::vector<double> values;
+
+	explicit vector3(double x = 0.0, double y = 0.0, double z = 0.0): values{x, y, z} {}
+	vector3(const vector3& other): values(other.values) { ++copies; }
+	vector3(vector3&&) = default;
+	vector3& operator=(const vector3& other){ values = other.values; ++copies; return *this; }
+	vector3& operator=(vector3&&) = default;
+
+	vector3& operator+=(const vector3& other){
+		for(std::size_t i = 0; i < 3; ++i){ values[i] += other.values[i]; }
+		return *this;
+	}
+	vector3& operator-=(const vector3& other){
+		for(std::size_t i = 0; i < 3; ++i){ values[i] -= other.values[i]; }
+		return *this;
+	}
+	vector3& operator*=(double factor){
+		for(double& value: values){ value *= factor; }
+		return *this;
+	}
+	vector3& operator/=(double divisor){
+		for(double& value: values){ value /= divisor; }
+		return *this;
+	}
+	bool operator==(const vector3& other) const { return values == other.values; }
+};
+
+std::size_t vector3::copies = 0;
+
+struct force_t{};
+using force = type_builder::basic_number<vector3, force_t, type_builder::ENABLE_SPECIFIC_PLUS_MINUS
+	| type_builder::ENABLE_FLOAT_MULT_DIV | type_builder::ENABLE_SPECIFIC_EQUALITY_CHECK
+	| type_builder::ENABLE_LAZY_EVALUATION>;
+
+struct count_t{};
+using count = type_builder::basic_number<int, count_t, type_builder::DEFAULT_SETTINGS
+	| type_builder::ENABLE_ALL_SPECIFIC_MATH | type_builder::ENABLE_LAZY_EVALUATION>;
+
+struct eager_t{};
+using eager = type_builder::basic_number<int, eager_t, type_builder::DEFAULT_SETTINGS
+	| type_builder::ENABLE_ALL_SPECIFIC_MATH>;
+
+// the operators only build expressions, which are equivalent to the numbers:
+static_assert(!std::is_same<decltype(std::declval<count>() + std::declval<count>()), count>::value, "");
+static_assert(std::is_same<decltype(std::declval<eager>() + std::declval<eager>()), eager>::value, "");
+static_assert(std::is_convertible<decltype(std::declval<count>() * 2 - std::declval<count>()),
+	count>::value, "");
+// expressions of other number-types are not:
+static_assert(!std::is_convertible<decltype(std::declval<count>() + std::declval<count>()),
+	eager>::value, "");
+
+int main(){
+	// the example of performance.cpp, without any copies:
+	force a{vector3{1.0, 2.0, 3.0}};
+	const force tmp{vector3{1.0, 1.0, 1.0}};
+	const force c{vector3{0.5, 0.5, 0.5}};
+	vector3::copies = 0;
+	a += tmp + (c + c);
+	assert(vector3::copies == 0);
+	assert((a == force{vector3{3.0, 4.0, 5.0}}));
+	vector3::copies = 0;
+	a -= tmp - c;
+	assert(vector3::copies == 0);
+	assert((a == force{vector3{2.5, 3.5, 4.5}}));
+	vector3::copies = 0;
+	a = c + tmp + c;
+	assert(vector3::copies == 1);
+	assert((a == force{vector3{2.0, 2.0, 2.0}}));
+
+	// only a product that is added is computed in a temporary:
+	vector3::copies = 0;
+	a = tmp * 2.0 + c / 0.5;
+	assert(vector3::copies == 2);
+	assert((a == force{vector3{3.0, 3.0, 3.0}}));
+
+	// a target that is an operand is evaluated into a temporary first:
+	a = c - a;
+	assert((a == force{vector3{-2.5, -2.5, -2.5}}));
+	a -= c - a;
+	assert((a == force{vector3{-5.5, -5.5, -5.5}}));
+	const force d = a + a;
+	assert((d == force{vector3{-11.0, -11.0, -11.0}}));
+
+	count x{10};
+	const count y{3};
+	x += y * 2 - count{4};
+	assert(x == count{12});
+	x = x / y + count{7} * y;
+	assert(x == count{25});
+	x *= y - count{1};
+	assert(x == count{50});
+	x /= count{5} * 2;
+	assert(x == count{5});
+	assert(count{20} == 4 * (x - count{0}));
+	assert(y < x + y && x + y > y);
+	assert(count{16} == (x - y) * (x + y) && (x - y) * (x + y) == count{4} * 4);
+}
@@ -0,0 +1,130 @@
+// Compares the heap-allocations of arithmetic on an allocating type with and without
+// basic_number around it.
+//
+// usage: basic_number_move <mode> <iterations>
+// 'r': raw samples, 'n': samples wrapped in a basic_number
+// Without arguments it checks that both allocate equally often.
+#include "../include/basic_number.hpp"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+static std::size_t allocations = 0;
+
+void* operator new(std::size_t size){
+	++allocations;
+	if(void* memory = std::malloc(size == 0 ? 1 : size)){
+		return memory;
+	}
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* memory) noexcept{
+	std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept{
+	std::free(memory);
+}
+
+// an allocating type with the usual operators, that reuse expiring left operands:
+struct samples{
+	std::vector<double> values;
+
+	samples& operator+=(const samples& other){
+		for(std::size_t i = 0; i < values.size(); ++i){ values[i] += other.values[i]; }
+		return *this;
+	}
+	samples& operator-=(const samples& other){
+		for(std::size_t i = 0; i < values.size(); ++i){ values[i] -= other.values[i]; }
+		return *this;
+	}
+	samples& operator*=(const samples& other){
+		for(std::size_t i = 0; i < values.size(); ++i){ values[i] *= other.values[i]; }
+		return *this;
+	}
+	samples& operator/=(const samples& other){
+		for(std::size_t i = 0; i < values.size(); ++i){ values[i] /= other.values[i]; }
+		return *this;
+	}
+	friend samples operator+(samples lhs, const samples& rhs){ return std::move(lhs += rhs); }
+	friend samples operator-(samples lhs, const samples& rhs){ return std::move(lhs -= rhs); }
+	friend samples operator*(samples lhs, const samples& rhs){ return std::move(lhs *= rhs); }
+	friend samples operator/(samples lhs, const samples& rhs){ return std::move(lhs /= rhs); }
+	bool operator==(const samples& other) const { return values == other.values; }
+};
+
+struct signal_t{};
+using signal = type_builder::basic_number<samples, signal_t, type_builder::ENABLE_SPECIFIC_PLUS_MINUS
+	| type_builder::ENABLE_SPECIFIC_MULTIPLICATION | type_builder::ENABLE_SPECIFIC_DIVISION
+	| type_builder::ENABLE_SPECIFIC_EQUALITY_CHECK>;
+
+static_assert(std::is_same<decltype(std::declval<signal>().get_value()), samples>::value, "");
+static_assert(std::is_same<decltype(std::declval<const signal&>().get_value_ref()),
+	const samples&>::value, "");
+
+static samples make_samples(double value){
+	return samples{std::vector<double>(64, value)};
+}
+
+static double run_raw(int n){
+	const samples a = make_samples(1.0), b = make_samples(2.0), c = make_samples(3.0),
+		d = make_samples(4.0), e = make_samples(8.0);
+	samples result = make_samples(0.0);
+	for(int i = 0; i < n; ++i){
+		result = (a + b) * c - d / e + a;
+		samples moved = std::move(result);
+		result = std::move(moved);
+	}
+	return result.values[0];
+}
+
+static double run_number(int n){
+	const signal a{make_samples(1.0)}, b{make_samples(2.0)}, c{make_samples(3.0)},
+		d{make_samples(4.0)}, e{make_samples(8.0)};
+	signal result{make_samples(0.0)};
+	for(int i = 0; i < n; ++i){
+		result = (a + b) * c - d / e + a;
+		samples moved = std::move(result).get_value();
+		result = signal{std::move(moved)};
+	}
+	return result.get_value_ref().values[0];
+}
+
+int main(int argc, char** argv){
+	if(argc == 1){
+		allocations = 0;
+		const double raw = run_raw(100);
+		const std::size_t raw_allocations = allocations;
+		allocations = 0;
+		const double number = run_number(100);
+		assert(raw == number && raw == 9.5);
+		assert(allocations == raw_allocations);
+		return 0;
+	}
+	if(argc != 3){
+		return 1;
+	}
+	const int n = std::atoi(argv[2]);
+	allocations = 0;
+	if(argv[1][0] == 'r'){
+		std::printf("samples: %g\n", run_raw(n));
+	}
+	else if(argv[1][0] == 'n'){
+		std::printf("signal: %g\n", run_number(n));
+	}
+	else{
+		return 2;
+	}
+	std::printf("allocations per iteration: %g\n", static_cast<double>(allocations) / n);
+}
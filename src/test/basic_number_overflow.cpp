@@ -0,0 +1,189 @@
+#include "../include/basic_number.hpp"
+#include "../include/basic_number_overflow.hpp"
+#include "../include/safe_int.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+enum: type_builder::flag_t{
+	settings = type_builder::DEFAULT_SETTINGS | type_builder::ENABLE_ALL_SPECIFIC_MATH
+		| type_builder::ENABLE_GENERAL_PLUS_MINUS | type_builder::ENABLE_MODULO
+};
+
+struct checked_t{};
+using checked = type_builder::basic_number<int, checked_t, settings
+	| type_builder::ENABLE_OVERFLOW_CHECK>;
+
+struct saturated_t{};
+using saturated = type_builder::basic_number<int, saturated_t, settings
+	| type_builder::ENABLE_SATURATING_OVERFLOW_CHECK>;
+
+struct usaturated_t{};
+using usaturated = type_builder::basic_number<std::uint8_t, usaturated_t, settings
+	| type_builder::ENABLE_SATURATING_OVERFLOW_CHECK>;
+
+// the results of native typing may have another type than the value:
+struct native_t{};
+using native = type_builder::basic_number<int, native_t, settings
+	| type_builder::ENABLE_SATURATING_OVERFLOW_CHECK | type_builder::ENABLE_NATIVE_TYPING>;
+
+struct big_t{};
+using big = type_builder::basic_number<std::int64_t, big_t, settings
+	| type_builder::ENABLE_SATURATING_OVERFLOW_CHECK>;
+
+struct real_t{};
+using real = type_builder::basic_number<double, real_t, settings
+	| type_builder::ENABLE_FLOAT_MULT_DIV | type_builder::ENABLE_OVERFLOW_CHECK>;
+
+// a safe_int in a basic_number checks itself, like in test_type_3 of test.cpp:
+struct nested_t{};
+using nested = type_builder::basic_number<type_builder::safe_int<int>, nested_t, settings
+	| type_builder::ENABLE_OVERFLOW_CHECK>;
+
+constexpr int max = std::numeric_limits<int>::max();
+constexpr int min = std::numeric_limits<int>::min();
+
+// the layout doesn't change and the checks work at compile-time:
+static_assert(sizeof(checked) == sizeof(int), "");
+static_assert(std::is_trivially_copyable<checked>::value, "");
+static_assert((checked{max - 1} + checked{1}).get_value() == max, "");
+static_assert((saturated{max} + saturated{1}).get_value() == max, "");
+static_assert((saturated{min} - saturated{1}).get_value() == min, "");
+static_assert((saturated{max} * 2).get_value() == max, "");
+static_assert((saturated{min} * -1).get_value() == max, "");
+static_assert((saturated{-3} * max).get_value() == min, "");
+static_assert((saturated{min} / saturated{-1}).get_value() == max, "");
+static_assert((-saturated{min}).get_value() == max, "");
+static_assert((usaturated{3} - usaturated{5}).get_value() == 0, "");
+// the operand is converted to the type of the value with a check as well:
+static_assert((saturated{1} * 10000000000LL).get_value() == max, "");
+static_assert((usaturated{200} + 300).get_value() == 255, "");
+// only the builtins compute the exact result of operands of different types:
+#if defined(TYPE_BUILDER_HAS_OVERFLOW_PREDICATES) || defined(TYPE_BUILDER_HAS_OVERFLOW_BUILTINS)
+static_assert((usaturated{200} + -100).get_value() == 100, "");
+// the direction of the saturation is the sign of the exact result:
+static_assert((native{-5} + 3u).get_value() == 0u, "");
+static_assert((native{5} + 3u).get_value() == 8u, "");
+static_assert((native{-5} - 3u).get_value() == 0u, "");
+static_assert((native{-1} - std::numeric_limits<unsigned>::max()).get_value() == 0u, "");
+static_assert((native{3} - 5u).get_value() == 0u, "");
+static_assert((native{max} + std::numeric_limits<unsigned>::max()).get_value()
+	== std::numeric_limits<unsigned>::max(), "");
+static_assert((native{-1} + std::numeric_limits<unsigned>::max()).get_value()
+	== std::numeric_limits<unsigned>::max() - 1, "");
+#endif
+
+// scaling is checked as well, in a wider type or in two parts for 64 bits:
+using type_builder::scale;
+static_assert((saturated{max} * scale<std::ratio<3, 1>>{}).get_value() == max, "");
+static_assert((saturated{min} * scale<std::ratio<3, 2>>{}).get_value() == min, "");
+static_assert((saturated{-7} * scale<std::ratio<3, 2>>{}).get_value() == -10, "");
+static_assert((big{std::numeric_limits<std::int64_t>::max() / 3 * 2} * scale<std::ratio<3, 2>>{}).get_value()
+	== std::numeric_limits<std::int64_t>::max() - 1, "");
+static_assert((big{std::numeric_limits<std::int64_t>::max() - 1} * scale<std::ratio<3, 2>>{}).get_value()
+	== std::numeric_limits<std::int64_t>::max(), "");
+static_assert((big{std::numeric_limits<std::int64_t>::min()} * scale<std::ratio<5, 4>>{}).get_value()
+	== std::numeric_limits<std::int64_t>::min(), "");
+
+// the operators of numbers with checks may throw:
+static_assert(!noexcept(checked{1} + checked{1}), "");
+static_assert(!noexcept(++std::declval<checked&>()), "");
+static_assert(!noexcept(checked{1} * scale<std::ratio<3, 2>>{}), "");
+static_assert(!noexcept(scale<std::ratio<3, 2>>{} * checked{1}), "");
+static_assert(!noexcept(std::declval<checked&>() *= scale<std::ratio<3, 2>>{}), "");
+
+template<typename Texception, typename Tfunction>
+static bool throws(Tfunction function){
+	try{
+		function();
+	}
+	catch(Texception&){
+		return true;
+	}
+	return false;
+}
+
+int main(){
+	checked a{max};
+	assert(throws<std::overflow_error>([&]{ a + checked{1}; }));
+	assert(throws<std::overflow_error>([&]{ a += checked{1}; }));
+	assert(a == checked{max});
+	assert(throws<std::overflow_error>([&]{ ++a; }));
+	assert(throws<std::overflow_error>([&]{ a++; }));
+	assert(throws<std::overflow_error>([&]{ a * 2; }));
+	assert(throws<std::overflow_error>([&]{ a *= 2; }));
+	assert(throws<std::underflow_error>([&]{ a * -2; }));
+	assert(throws<std::underflow_error>([&]{ -a - checked{2}; }));
+	assert(throws<std::overflow_error>([&]{ a * scale<std::ratio<3, 1>>{}; }));
+	assert(throws<std::overflow_error>([&]{ a *= scale<std::ratio<3, 2>>{}; }));
+	assert(throws<std::underflow_error>([&]{ a * scale<std::ratio<-3, 2>>{}; }));
+	assert(a == checked{max});
+	assert((a * scale<std::ratio<1, 2>>{}) == checked{max / 2});
+	a = checked{min};
+	assert(throws<std::underflow_error>([&]{ --a; }));
+	assert(throws<std::underflow_error>([&]{ a--; }));
+	assert(throws<std::underflow_error>([&]{ a -= checked{1}; }));
+	assert(throws<std::overflow_error>([&]{ -a; }));
+	assert(throws<std::overflow_error>([&]{ a / checked{-1}; }));
+	assert(throws<std::overflow_error>([&]{ a /= -1; }));
+	assert(throws<std::domain_error>([&]{ a / 0; }));
+	assert(throws<std::domain_error>([&]{ a % 0; }));
+	assert(throws<std::overflow_error>([&]{ a + 10000000000LL; }));
+	assert(a == checked{min});
+	// min % -1 is 0 like in safe_int instead of undefined:
+	assert(a % checked{-1} == checked{0});
+	// also with a divisor:
+	const type_builder::divisor<int> minus_one{-1};
+	assert(throws<std::overflow_error>([&]{ a / minus_one; }));
+	assert(throws<std::overflow_error>([&]{ a /= minus_one; }));
+	assert(a == checked{min});
+	assert(a % minus_one == checked{0});
+	assert(a / type_builder::divisor<int>{-2} == checked{min / -2});
+	assert((saturated{min} / minus_one).get_value() == max);
+
+	// without an overflow the results are those of int:
+	checked b{7};
+	assert(b++ == checked{7});
+	assert(--b == checked{7});
+	b += checked{5};
+	b -= 2;
+	b *= checked{3};
+	b /= 4;
+	b %= checked{5};
+	assert(b == checked{2});
+	assert(-b * checked{-50} / 3 % 7 == checked{5});
+
+	saturated s{max - 2};
+	s += saturated{10};
+	assert(s == saturated{max});
+	++s;
+	assert(s == saturated{max});
+	s = saturated{min};
+	assert(s-- == saturated{min});
+	assert(s == saturated{min});
+	assert(s / 0 == saturated{min});
+	assert(saturated{5} / 0 == saturated{max});
+	assert(saturated{5} % 0 == saturated{5});
+
+	big c{std::numeric_limits<std::int64_t>::max()};
+	c *= c;
+	assert(c == big{std::numeric_limits<std::int64_t>::max()});
+	c = -c - big{5};
+	assert(c == big{std::numeric_limits<std::int64_t>::min()});
+
+	// floating-point numbers are not checked:
+	real r{1e308};
+	r *= 10.0;
+	assert(r.get_value() == std::numeric_limits<double>::infinity());
+
+	nested n{type_builder::safe_int<int>{max}};
+	assert(throws<std::overflow_error>([&]{ ++n; }));
+	assert(throws<std::overflow_error>([&]{ n * nested{type_builder::safe_int<int>{2}}; }));
+}
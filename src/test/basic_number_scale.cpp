@@ -0,0 +1,121 @@
+#include "../include/basic_number.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+#include <type_traits>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+using type_builder::rounding;
+using type_builder::scale;
+
+struct length_t{};
+using length = type_builder::basic_number<int, length_t, type_builder::DEFAULT_SETTINGS>;
+
+struct ulength_t{};
+using ulength = type_builder::basic_number<unsigned, ulength_t, type_builder::DEFAULT_SETTINGS>;
+
+struct big_t{};
+using big = type_builder::basic_number<std::int64_t, big_t, type_builder::DEFAULT_SETTINGS>;
+
+struct constant_t{};
+using constant = type_builder::basic_number<int, constant_t, type_builder::DEFAULT_SETTINGS
+	| type_builder::DISABLE_MUTABILITY>;
+
+struct label_t{};
+using label = type_builder::basic_number<int, label_t, type_builder::ENABLE_SPECIFIC_EQUALITY_CHECK>;
+
+struct real_t{};
+using real = type_builder::basic_number<double, real_t, type_builder::DEFAULT_SETTINGS>;
+
+using three_halves = std::ratio<3, 2>;
+
+// scaling keeps the type and is usable at compile-time:
+static_assert(std::is_same<decltype(length{} * scale<three_halves>{}), length>::value, "");
+static_assert(std::is_same<decltype(scale<three_halves>{} * length{}), length>::value, "");
+static_assert((length{7} * scale<three_halves>{}).get_value() == 10, "");
+static_assert((length{-7} * scale<three_halves>{}).get_value() == -10, "");
+static_assert((length{-7} * scale<three_halves, rounding::down>{}).get_value() == -11, "");
+static_assert((length{7} * scale<three_halves, rounding::up>{}).get_value() == 11, "");
+static_assert((length{-7} * scale<three_halves, rounding::to_nearest>{}).get_value() == -11, "");
+static_assert((length{6} * scale<std::ratio<-4, 6>>{}).get_value() == -4, "");
+// near the limits only the result has to fit:
+static_assert((length{std::numeric_limits<int>::max()} * scale<std::ratio<2, 3>>{}).get_value()
+	== 1431655764, "");
+static_assert((big{std::numeric_limits<std::int64_t>::max()} * scale<std::ratio<2, 3>>{}).get_value()
+	== 6148914691236517204, "");
+static_assert((big{-7} * scale<three_halves, rounding::to_nearest>{}).get_value() == -11, "");
+static_assert((ulength{std::numeric_limits<unsigned>::max()} * scale<std::ratio<1, 2>,
+	rounding::up>{}).get_value() == 2147483648u, "");
+
+template<typename T, typename Tscale, typename = void>
+struct can_scale: std::false_type{};
+template<typename T, typename Tscale>
+struct can_scale<T, Tscale, decltype(void(std::declval<T>() * Tscale{}))>: std::true_type{};
+
+template<typename T, typename Tscale, typename = void>
+struct can_scale_assign: std::false_type{};
+template<typename T, typename Tscale>
+struct can_scale_assign<T, Tscale, decltype(void(std::declval<T&>() *= Tscale{}))>: std::true_type{};
+
+static_assert(can_scale<constant, scale<three_halves>>::value, "");
+static_assert(!can_scale_assign<constant, scale<three_halves>>::value, "");
+static_assert(!can_scale<label, scale<three_halves>>::value, "");
+static_assert(!can_scale<real, scale<three_halves>>::value, "");
+
+// compares with the exact product of the numbers, rounded in long double:
+template<typename Tratio, rounding Tmode>
+static void check(long long value){
+	const long double exact = static_cast<long double>(value) * Tratio::num / Tratio::den;
+	long double expected = 0;
+	switch(Tmode){
+		case rounding::toward_zero: expected = std::trunc(exact); break;
+		case rounding::down: expected = std::floor(exact); break;
+		case rounding::up: expected = std::ceil(exact); break;
+		case rounding::to_nearest: expected = std::round(exact); break;
+	}
+	const length result = length{static_cast<int>(value)} * scale<Tratio, Tmode>{};
+	assert(result.get_value() == static_cast<long long>(expected));
+	// 64-bit integers are scaled without a wider type:
+	const big wide = big{value} * scale<Tratio, Tmode>{};
+	assert(wide.get_value() == static_cast<long long>(expected));
+}
+
+template<typename Tratio>
+static void check_all(long long value){
+	check<Tratio, rounding::toward_zero>(value);
+	check<Tratio, rounding::down>(value);
+	check<Tratio, rounding::up>(value);
+	check<Tratio, rounding::to_nearest>(value);
+}
+
+int main(){
+	for(long long value = -1000; value <= 1000; ++value){
+		check_all<std::ratio<7, 2>>(value);
+		check_all<std::ratio<-7, 2>>(value);
+		check_all<std::ratio<2, 3>>(value);
+		check_all<std::ratio<5, 1>>(value);
+		check_all<std::ratio<1, 1000>>(value);
+		check_all<std::ratio<-13, 10>>(value);
+	}
+	for(long long value: {static_cast<long long>(std::numeric_limits<int>::min()),
+			static_cast<long long>(std::numeric_limits<int>::max())}){
+		check_all<std::ratio<1, 3>>(value);
+		check_all<std::ratio<999, 1000>>(value);
+	}
+
+	length x{9};
+	x *= scale<std::ratio<7, 2>>{};
+	assert(x == length{31});
+	x *= scale<std::ratio<1, 2>, rounding::up>{};
+	assert(x == length{16});
+	ulength y{5};
+	y *= scale<std::ratio<3, 4>, rounding::to_nearest>{};
+	assert(y == ulength{4});
+	assert((scale<std::ratio<1, 4>, rounding::down>{} * ulength{7} == ulength{1}));
+}
@@ -0,0 +1,72 @@
+#include "../include/basic_number.hpp"
+#include "physical.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+struct identifier_t{};
+using identifier = type_builder::basic_number<std::uint32_t, identifier_t,
+	type_builder::ENABLE_SPECIFIC_EQUALITY_CHECK>;
+
+struct frozen_t{};
+using frozen = type_builder::basic_number<int, frozen_t, type_builder::DISABLE_MUTABILITY
+	| type_builder::ENABLE_SPECIFIC_EQUALITY_CHECK>;
+
+struct nested_t{};
+using nested = type_builder::basic_number<identifier, nested_t>;
+
+using type_builder::as_numbers;
+using type_builder::as_underlying;
+using type_builder::make_span;
+using type_builder::span;
+
+// the numbers have the layout of their values and can be copied like them:
+static_assert(sizeof(meter) == sizeof(double) && alignof(meter) == alignof(double), "");
+static_assert(sizeof(identifier) == sizeof(std::uint32_t)
+	&& alignof(identifier) == alignof(std::uint32_t), "");
+static_assert(sizeof(nested) == sizeof(std::uint32_t), "");
+static_assert(std::is_trivially_copyable<meter>::value, "");
+static_assert(std::is_trivially_copy_assignable<identifier>::value, "");
+static_assert(std::is_trivially_move_assignable<identifier>::value, "");
+static_assert(std::is_trivially_copyable<nested>::value, "");
+// immutable numbers can still be copied, but not assigned to:
+static_assert(std::is_trivially_copyable<frozen>::value, "");
+static_assert(std::is_trivially_copy_constructible<frozen>::value, "");
+static_assert(!std::is_copy_assignable<frozen>::value, "");
+static_assert(!std::is_move_assignable<frozen>::value, "");
+
+static_assert(std::is_same<decltype(as_underlying(std::declval<span<const meter>>())),
+	span<const double>>::value, "");
+static_assert(std::is_same<decltype(as_numbers<identifier>(std::declval<span<const std::uint32_t>>())),
+	span<const identifier>>::value, "");
+
+int main(){
+	std::vector<meter> distances{meter{1.0}, meter{2.5}, meter{4.0}};
+	const auto values = as_underlying(make_span(distances));
+	assert(values.size() == 3);
+	assert(std::accumulate(values.begin(), values.end(), 0.0) == 7.5);
+	values[1] = 3.0;
+	assert(distances[1] == meter{3.0});
+
+	const std::vector<std::uint32_t> raw{3, 1, 2};
+	const auto identifiers = as_numbers<identifier>(make_span(raw));
+	assert(identifiers.data() == static_cast<const void*>(raw.data()));
+	assert(identifiers[0] == identifier{3u} && identifiers[2] == identifier{2u});
+
+	// copies of trivially copyable numbers are plain copies of bytes:
+	std::vector<identifier> copy(identifiers.size(), identifier{0u});
+	std::memcpy(copy.data(), identifiers.data(), identifiers.size() * sizeof(identifier));
+	assert(std::equal(copy.begin(), copy.end(), identifiers.begin()));
+
+	const frozen constants[] = {frozen{1}, frozen{2}};
+	assert(as_underlying(span<const frozen>{constants})[1] == 2);
+}
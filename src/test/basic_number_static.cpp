@@ -0,0 +1,78 @@
+#include "../include/basic_number.hpp"
+#include "physical.hpp"
+
+#include <type_traits>
+
+struct int_id{};
+using integer = type_builder::basic_number<int, int_id, type_builder::ENABLE_ALL>;
+
+struct counter_id{};
+using counter = type_builder::basic_number<unsigned, counter_id, type_builder::DEFAULT_SETTINGS
+	| type_builder::ENABLE_LATE_ASSIGNEMENT | type_builder::ENABLE_DEFAULT_CONSTRUCTION>;
+
+using meter_per_second = decltype(std::declval<meter>() / std::declval<second>());
+
+// an underlying type whose operations may throw:
+struct throwing{
+	int value;
+	throwing(int value): value{value} {}
+	throwing(const throwing&) = default;
+	throwing& operator=(const throwing& other){ value = other.value; return *this; }
+	throwing& operator=(throwing&& other){ value = other.value; return *this; }
+	throwing operator+(const throwing& other) const { return throwing{value + other.value}; }
+	bool operator==(const throwing& other) const { return value == other.value; }
+};
+
+struct throwing_id{};
+using throwing_number = type_builder::basic_number<throwing, throwing_id>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+
+// tables of typed values are constant-initialized:
+constexpr meter distances[] = {meter{1.0}, meter{2.5}, meter{4.0} * 2, meter{3.0} + meter{1.0}};
+constexpr second times[] = {second{2.0}, second{0.5}, second{4.0}, second{1.0}};
+constexpr meter_per_second speeds[] = {distances[0] / times[0], distances[1] / times[1],
+	distances[2] / times[2], distances[3] / times[3]};
+
+static_assert(distances[2].get_value() == 8.0, "");
+static_assert(speeds[0] == meter_per_second{0.5}, "");
+static_assert(speeds[1] > speeds[2], "");
+static_assert(speeds[2] == meter_per_second{2.0} && speeds[3] == meter_per_second{4.0}, "");
+static_assert((speeds[1] * times[1]).get_value() == 2.5, "");
+static_assert(std::is_trivially_destructible<meter>::value, "");
+
+static_assert(integer{7} + 3 == 10, "");
+static_assert(2 * integer{7} - integer{4} == 10, "");
+static_assert(integer{7} / 2 == 3 && integer{7} % 4 == 3, "");
+static_assert(-integer{7} < integer{0}, "");
+static_assert(counter{} == counter{0u}, "");
+
+#if __cplusplus >= 201402L
+// the members that modify the value are constexpr as well since C++14:
+constexpr counter sum_up_to(unsigned n){
+	counter result{};
+	for(counter i{1u}; i <= counter{n}; ++i){
+		result += i;
+	}
+	result = result * 2u;
+	return result;
+}
+static_assert(sum_up_to(100) == counter{10100u}, "");
+#endif
+
+// the operations are noexcept if the ones of the underlying type are:
+static_assert(std::is_nothrow_move_constructible<integer>::value, "");
+static_assert(std::is_nothrow_move_assignable<integer>::value, "");
+static_assert(std::is_nothrow_copy_assignable<meter>::value, "");
+static_assert(noexcept(std::declval<integer&>() += 1), "");
+static_assert(noexcept(std::declval<integer>() * std::declval<integer>()), "");
+static_assert(noexcept(std::declval<meter>() < std::declval<meter>()), "");
+static_assert(noexcept(++std::declval<counter&>()), "");
+static_assert(noexcept(std::declval<meter>().get_value()), "");
+
+static_assert(!std::is_nothrow_move_assignable<throwing_number>::value, "");
+static_assert(!std::is_nothrow_copy_assignable<throwing_number>::value, "");
+static_assert(!noexcept(std::declval<throwing_number>() + std::declval<throwing_number>()), "");
+static_assert(!noexcept(std::declval<throwing_number>() == std::declval<throwing_number>()), "");
+
+int main(){}
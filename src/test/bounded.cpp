@@ -0,0 +1,103 @@
+#include "../include/bounded.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+using type_builder::bounded;
+
+using byte = bounded<std::uint8_t, 0, 255>;
+using offset = bounded<int, -16, 16>;
+using index = bounded<std::uint16_t, 0, 1000>;
+using I64 = bounded<std::int64_t, INT64_MIN, INT64_MAX>;
+using I64_sat = bounded<std::int64_t, INT64_MIN, INT64_MAX, type_builder::saturate_on_error>;
+using U64 = bounded<std::uint64_t, 0, INT64_MAX>;
+using U64_sat = bounded<std::uint64_t, 0, INT64_MAX, type_builder::saturate_on_error>;
+
+#define ASSERT_THROW_EX(expr, exception) \
+	do{ try{ expr; assert(false); } catch (exception& e){ assert(true); } }while(false)
+
+// the bounds and storage of the results:
+static_assert(std::is_same<decltype(std::declval<byte>() + std::declval<byte>()),
+	bounded<std::uint16_t, 0, 510>>::value, "");
+static_assert(std::is_same<decltype(std::declval<byte>() - std::declval<byte>()),
+	bounded<std::int16_t, -255, 255>>::value, "");
+static_assert(std::is_same<decltype(std::declval<byte>() * std::declval<byte>()),
+	bounded<std::uint16_t, 0, 65025>>::value, "");
+static_assert(std::is_same<decltype(std::declval<offset>() * std::declval<offset>()),
+	bounded<int, -256, 256>>::value, "");
+static_assert(std::is_same<decltype(std::declval<index>() / std::declval<offset>()),
+	bounded<int, -1000, 1000>>::value, "");
+static_assert(std::is_same<decltype(-std::declval<byte>()),
+	bounded<std::int16_t, -255, 0>>::value, "");
+static_assert(std::is_same<decltype(std::declval<I64>() + std::declval<byte>()),
+	bounded<std::int64_t, INT64_MIN, INT64_MAX>>::value, "");
+
+// mixed signed and unsigned 64 bit integers share a 128 bit type, but the storage
+// of their results is at most 64 bits wide:
+static_assert(std::is_same<decltype(std::declval<bounded<std::uint64_t, 0, 10>>()
+	+ std::declval<bounded<std::int64_t, -5, 0>>()), bounded<std::int64_t, -5, 10>>::value, "");
+static_assert(std::is_same<decltype(std::declval<U64>() - std::declval<I64>()),
+	bounded<std::int64_t, -INT64_MAX, INT64_MAX>>::value, "");
+#if defined(TYPE_BUILDER_HAS_INT128)
+static_assert(type_builder::impl::bound_min<type_builder::int128_t>() == INTMAX_MIN, "");
+static_assert(type_builder::impl::bound_max<type_builder::uint128_t>() == INTMAX_MAX, "");
+static_assert(type_builder::impl::above_bound(type_builder::int128_t{1} << 64, 0), "");
+#endif
+
+// checks are only done if the result may not fit into the storage:
+static_assert(!type_builder::impl::bounded_result<type_builder::impl::bounded_mul, byte, byte>::checked, "");
+static_assert(type_builder::impl::bounded_result<type_builder::impl::bounded_add, I64, byte>::checked, "");
+
+// widening is implicit, narrowing is explicit:
+static_assert(std::is_convertible<byte, index>::value, "");
+static_assert(!std::is_convertible<index, byte>::value, "");
+
+static_assert((byte{200} + byte{100}).get_value() == 300, "");
+static_assert((offset{-16} * offset{16}).get_value() == -256, "");
+
+int main(){
+	const byte b200{200}, b255{255};
+	const offset o_neg{-3}, o_zero{0};
+	
+	assert((b200 + b255).get_value() == 455);
+	assert((b200 - b255).get_value() == -55);
+	assert((b200 * b255).get_value() == 51000);
+	assert((b200 / o_neg).get_value() == -66);
+	assert(b200 < b255);
+	assert(b200 + b200 > b255);
+	assert(o_neg < b200);
+	
+	ASSERT_THROW_EX(byte{256}, std::out_of_range);
+	ASSERT_THROW_EX(byte{-1}, std::out_of_range);
+	ASSERT_THROW_EX(byte{b200 + b200}, std::out_of_range);
+	ASSERT_THROW_EX(b200 / o_zero, std::domain_error);
+	ASSERT_THROW_EX(I64{INT64_MAX} + byte{1}, std::overflow_error);
+	assert((I64_sat{INT64_MAX} * I64_sat{2}).get_value() == INT64_MAX);
+	// the storage doesn't overflow, but the result exceeds its saturated bounds:
+	ASSERT_THROW_EX(U64{INT64_MAX} + U64{INT64_MAX}, std::overflow_error);
+	ASSERT_THROW_EX(U64{INT64_MAX} * U64{2}, std::overflow_error);
+	assert((bounded<std::uint64_t, 0, 10>{5} + bounded<std::int64_t, -5, 0>{-5}).get_value() == 0);
+	assert((U64{INT64_MAX} + I64{INT64_MIN}).get_value() == -1);
+	ASSERT_THROW_EX(U64{0} - I64{INT64_MIN}, std::overflow_error);
+	assert((U64_sat{INT64_MAX} + U64_sat{1}).get_value() == INT64_MAX);
+	assert((U64{INT64_MAX - 1} + U64{1}).get_value() == INT64_MAX);
+	
+	index i{998};
+	++i;
+	i += byte{1};
+	assert(i.get_value() == 1000);
+	ASSERT_THROW_EX(++i, std::overflow_error);
+	ASSERT_THROW_EX(i += byte{1}, std::out_of_range);
+	
+	index sum{0};
+	for(byte b{0}; b < byte{10}; ++b){
+		sum += b;
+	}
+	assert(sum == byte{45});
+	assert(sum.to_safe_int() == type_builder::safe_int<std::uint16_t>{45});
+}
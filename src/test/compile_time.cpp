@@ -0,0 +1,69 @@
+// Measures how expensive basic_number is for the compiler: it creates
+// TYPE_BUILDER_BENCHMARK_TYPES distinct number-types and uses each of their operators
+// once. Compare the time and the size of the object-file of different versions or
+// language-modes with something like:
+//
+//   time g++ -std=c++11 -O0 -c compile_time.cpp -o compile_time.o && size compile_time.o
+//   time g++ -std=c++20 -O0 -c compile_time.cpp -o compile_time.o && size compile_time.o
+#include "../include/basic_number.hpp"
+#include <cstdio>
+
+#ifndef TYPE_BUILDER_BENCHMARK_TYPES
+#	define TYPE_BUILDER_BENCHMARK_TYPES 100
+#endif
+
+enum: type_builder::flag_t{
+	benchmark_settings = type_builder::ENABLE_ALL_SPECIFIC_MATH
+		| type_builder::ENABLE_ORDERING
+		| type_builder::ENABLE_INTEGER_MULT_DIV
+		| type_builder::ENABLE_LATE_ASSIGNEMENT
+};
+
+template<int Tn>
+struct id{};
+
+template<int Tn>
+using number = type_builder::basic_number<long, id<Tn>, benchmark_settings>;
+
+template<int Tn>
+long use_operators(long seed){
+	number<Tn> a{seed};
+	const number<Tn> b{seed + Tn};
+	a += b;
+	a -= number<Tn>{1};
+	a *= b;
+	a /= b;
+	a %= b;
+	a *= 3;
+	a /= 2;
+	++a;
+	a--;
+	const number<Tn> c = (a + b) * b / (b + number<Tn>{1}) % b - a;
+	const number<Tn> d = -(2 * c * 3) / 2;
+	return (c == d) + (c != b) + (c < d) + (c <= b) + (c > d) + (c >= b) + c.get_value();
+}
+
+template<int... Tns>
+struct sequence{};
+
+template<int Tn, int... Tns>
+struct make_sequence: make_sequence<Tn - 1, Tn - 1, Tns...>{};
+
+template<int... Tns>
+struct make_sequence<0, Tns...>{
+	using type = sequence<Tns...>;
+};
+
+template<int... Tns>
+long use_all(sequence<Tns...>, long seed){
+	const long results[] = {use_operators<Tns>(seed)...};
+	long sum = 0;
+	for(long result: results){
+		sum += result;
+	}
+	return sum;
+}
+
+int main(int argc, char**){
+	std::printf("%ld\n", use_all(make_sequence<TYPE_BUILDER_BENCHMARK_TYPES>::type{}, argc + 3));
+}
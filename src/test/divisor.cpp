@@ -0,0 +1,148 @@
+#include "../include/basic_number.hpp"
+#include "../include/divisor.hpp"
+#include "../include/safe_int.hpp"
+#include "../include/safe_int_divisor.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+using type_builder::divisor;
+
+// every dividend and divisor of the small types:
+template<typename T>
+static void check_all(){
+	for(int d = std::numeric_limits<T>::min(); d <= std::numeric_limits<T>::max(); ++d){
+		if(d == 0){
+			continue;
+		}
+		const divisor<T> fast{static_cast<T>(d)};
+		for(int n = std::numeric_limits<T>::min(); n <= std::numeric_limits<T>::max(); ++n){
+			if(n / d > std::numeric_limits<T>::max()){
+				continue; // min / -1
+			}
+			assert(static_cast<T>(n) / fast == static_cast<T>(n / d));
+			assert(static_cast<T>(n) % fast == static_cast<T>(n % d));
+		}
+	}
+}
+
+// the borders and some values in between of the large types:
+template<typename T>
+static void check_borders(){
+	const T max = std::numeric_limits<T>::max();
+	const T min = std::numeric_limits<T>::min();
+	const T values[] = {min, T(min + 1), T(min / 2), T(-1000003), T(-7), T(-1), T(0), T(1), T(2),
+		T(3), T(7), T(10007), T(1) << (sizeof(T) * 8 - 2), T(max / 3), T(max / 2 + 1), T(max - 1),
+		max};
+	for(const T d: values){
+		if(d == 0){
+			continue;
+		}
+		const divisor<T> fast{d};
+		assert(fast.get_value() == d);
+		for(const T n: values){
+			if(std::is_signed<T>::value && n == min && d == T(-1)){
+				continue;
+			}
+			assert(n / fast == n / d);
+			assert(n % fast == n % d);
+		}
+	}
+}
+
+struct bucket_t{};
+using bucket = type_builder::basic_number<int, bucket_t, type_builder::DEFAULT_SETTINGS
+	| type_builder::ENABLE_MODULO>;
+
+struct label_t{};
+using label = type_builder::basic_number<int, label_t, type_builder::ENABLE_SPECIFIC_EQUALITY_CHECK>;
+
+template<typename T, typename Tdivisor, typename = void>
+struct can_divide: std::false_type{};
+template<typename T, typename Tdivisor>
+struct can_divide<T, Tdivisor, decltype(void(std::declval<T>() / std::declval<Tdivisor>()))>:
+	std::true_type{};
+
+struct ticks_t{};
+using ticks = type_builder::basic_number<std::int64_t, ticks_t, type_builder::DEFAULT_SETTINGS
+	| type_builder::ENABLE_MODULO>;
+
+static_assert(can_divide<bucket, divisor<int>>::value, "");
+static_assert(!can_divide<label, divisor<int>>::value, "");
+// dividends of other types would be truncated to the type of the divisor:
+static_assert(!can_divide<ticks, divisor<int>>::value, "");
+static_assert(can_divide<ticks, divisor<std::int64_t>>::value, "");
+static_assert(!can_divide<std::int64_t, divisor<int>>::value, "");
+static_assert(!can_divide<short, divisor<int>>::value, "");
+static_assert(!can_divide<type_builder::safe_int<std::int64_t>, divisor<type_builder::safe_int<int>>>::value, "");
+
+// the reciprocal is computed at compile-time for constant divisors:
+constexpr divisor<int> seven{7};
+static_assert(-50 / seven == -7 && -50 % seven == -1, "");
+static_assert(50u / divisor<unsigned>{7u} == 7u, "");
+
+int main(){
+	check_all<std::int8_t>();
+	check_all<std::uint8_t>();
+	check_borders<std::int16_t>();
+	check_borders<std::int32_t>();
+	check_borders<std::uint32_t>();
+	check_borders<std::int64_t>();
+	check_borders<std::uint64_t>();
+
+	// basic_number divides by it with its integer-division and modulo:
+	const divisor<int> buckets{12};
+	bucket b{100};
+	assert(b / buckets == bucket{8});
+	assert(b % buckets == bucket{4});
+	b /= buckets;
+	assert(b == bucket{8});
+	b %= divisor<int>{5};
+	assert(b == bucket{3});
+	const ticks t{(std::int64_t{1} << 40) + 3};
+	assert(t / divisor<std::int64_t>{7} == ticks{157073089682});
+	assert(t % divisor<std::int64_t>{7} == ticks{5});
+
+	// safe_int checks the divisor for 0 only once:
+	using I32 = type_builder::safe_int<int>;
+	const divisor<I32> three{I32{3}};
+	assert(I32{-10} / three == I32{-3});
+	assert(I32{-10} % three == I32{-1});
+	I32 x{100};
+	x /= three;
+	x %= three;
+	assert(x == I32{0});
+	bool thrown = false;
+	try{
+		divisor<I32>{I32{0}};
+	}
+	catch(std::domain_error&){
+		thrown = true;
+	}
+	assert(thrown);
+	// the overflow of min / -1 is still checked:
+	const divisor<I32> minus_one{I32{-1}};
+	thrown = false;
+	try{
+		I32{std::numeric_limits<int>::min()} / minus_one;
+	}
+	catch(std::overflow_error&){
+		thrown = true;
+	}
+	assert(thrown);
+	assert(I32{std::numeric_limits<int>::min()} % minus_one == I32{0});
+	// policies that don't throw divide by 1 then:
+	using S32 = type_builder::safe_int<int, type_builder::saturate_on_error>;
+	const divisor<S32> zero{S32{0}};
+	assert(zero.get_value() == S32{1});
+	assert(S32{42} / zero == S32{42});
+	assert(S32{std::numeric_limits<int>::min()} / divisor<S32>{S32{-1}}
+		== S32{std::numeric_limits<int>::max()});
+}
@@ -0,0 +1,120 @@
+#include "../include/basic_number.hpp"
+#include "../include/flat_map.hpp"
+#include "../include/safe_int.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+using type_builder::flat_map;
+
+struct user_id_t{};
+using user_id = type_builder::basic_number<int, user_id_t, type_builder::ENABLE_SPECIFIC_EQUALITY_CHECK>;
+
+struct order_id_t{};
+using order_id = type_builder::basic_number<type_builder::safe_int<std::uint64_t>, order_id_t,
+	type_builder::ENABLE_SPECIFIC_EQUALITY_CHECK>;
+
+// random insertions and erasures, compared with std::map:
+template<typename Tkey>
+static void check_random(std::int64_t range){
+	flat_map<Tkey, long> map;
+	std::map<std::int64_t, long> expected;
+	std::mt19937_64 random{42};
+	for(int i = 0; i < 200000; ++i){
+		const std::int64_t raw = static_cast<std::int64_t>(random() % range);
+		const Tkey key = type_builder::impl::flat_map_key<Tkey>::make(
+			static_cast<typename type_builder::impl::flat_map_key<Tkey>::value_type>(raw));
+		switch(random() % 4){
+			case 0:
+			case 1:
+				assert(map.insert(key, i).second == expected.emplace(raw, i).second);
+				break;
+			case 2:
+				assert(map.erase(key) == (expected.erase(raw) == 1));
+				break;
+			case 3:
+				map[key] += 1;
+				expected[raw] += 1;
+				break;
+		}
+		assert(map.size() == expected.size());
+		assert(map.capacity() * 7 >= map.size() * 8);
+	}
+	for(const auto& element: expected){
+		const Tkey key = type_builder::impl::flat_map_key<Tkey>::make(
+			static_cast<typename type_builder::impl::flat_map_key<Tkey>::value_type>(element.first));
+		assert(map.find(key) != nullptr);
+		assert(*map.find(key) == element.second);
+	}
+	std::size_t count = 0;
+	map.for_each([&](const Tkey& key, long value){
+		++count;
+		assert(expected.at(type_builder::impl::flat_map_key<Tkey>::value(key)) == value);
+	});
+	assert(count == expected.size());
+}
+
+int main(){
+	flat_map<user_id, std::string> names;
+	assert(names.empty() && names.find(user_id{1}) == nullptr);
+	assert(names.insert(user_id{1}, "one").second);
+	assert(!names.insert(user_id{1}, "uno").second);
+	names[user_id{-2}] = "minus two";
+	assert(names.size() == 2);
+	assert(*names.find(user_id{1}) == "one");
+	assert(names.contains(user_id{-2}));
+	assert(!names.contains(user_id{2}));
+	assert(names.erase(user_id{1}));
+	assert(!names.erase(user_id{1}));
+	assert(names.size() == 1 && names.find(user_id{1}) == nullptr);
+	names.for_each([](const user_id& key, std::string& value){
+		assert(key == user_id{-2});
+		value += "!";
+	});
+	assert(names[user_id{-2}] == "minus two!");
+
+	// the sentinels are the largest values:
+	bool thrown = false;
+	try{
+		names[user_id{std::numeric_limits<int>::max()}];
+	}
+	catch(std::invalid_argument&){
+		thrown = true;
+	}
+	assert(thrown);
+	assert(!names.contains(user_id{std::numeric_limits<int>::max() - 1}));
+
+	// the storage is reserved up front and kept by clear():
+	flat_map<int, int> reserved(1000);
+	const std::size_t capacity = reserved.capacity();
+	assert(capacity * 7 >= 1000 * 8);
+	for(int i = 0; i < 1000; ++i){
+		reserved[i * 4096] = i;
+	}
+	assert(reserved.capacity() == capacity);
+	reserved.clear();
+	assert(reserved.empty() && reserved.capacity() == capacity && !reserved.contains(0));
+
+	// many erasures don't make the map grow:
+	flat_map<std::uint16_t, int> small;
+	for(int i = 0; i < 100000; ++i){
+		small[static_cast<std::uint16_t>(i % 50000)] = i;
+		small.erase(static_cast<std::uint16_t>((i + 25000) % 50000));
+	}
+	assert(small.capacity() <= 65536);
+
+	check_random<user_id>(1000);
+	check_random<user_id>(100000);
+	check_random<order_id>(5000);
+	check_random<std::int8_t>(100);
+	check_random<unsigned>(3000);
+}
@@ -0,0 +1,35 @@
+// Uses type_builder through its module instead of the headers (C++20 only).
+#include <cstdint>
+#include <stdexcept>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+// after the includes, since g++ 12 can't merge the standard-library of a module
+// with headers that are included after its import; it also still miscompiles the
+// streams of the standard-library in programs that import modules, so this test
+// doesn't use them:
+import type_builder;
+
+struct meter_t{};
+using meter = type_builder::basic_number<double, meter_t, type_builder::DEFAULT_SETTINGS>;
+
+using I32 = type_builder::safe_int<std::int32_t>;
+using I64 = type_builder::safe_int<std::int64_t>;
+
+int main(){
+	constexpr meter distance = meter{1.5} + meter{2.5};
+	static_assert(distance == meter{4.0}, "");
+	assert((distance * 2).get_value() == 8.0);
+
+	const I64 sum = I32{2000000000} + I64{2000000000};
+	assert(sum == I64{4000000000});
+	assert(I32{-1} < I64{1});
+	try{
+		I32{2000000000} + I32{2000000000};
+		assert(false);
+	}
+	catch(std::overflow_error&){}
+}
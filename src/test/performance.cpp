@@ -1,6 +1,7 @@
 #include "../include/basic_number.hpp"
 #include <cstdlib>
 #include <cstdio>
+#include <ratio>
 
 enum: type_builder::flag_t{
 	int_type_settings = type_builder::DEFAULT_SETTINGS
@@ -74,5 +75,55 @@ int main(int argc, char** argv){
 		printf("Int (with float): %d\n", a.get_value());
 		//return (a == Int(0));
 	}
+	else if(argv[1][0] == 's'){
+		int a(1), b(2), c(3);
+		for(int i=0; i<n; ++i){
+			int tmp = b*7/2;
+			a += tmp + (c+c);
+			c = c+c;
+			b *=2;
+			a %= 10000;
+			b %= 20000;
+			c %= 12345;
+		}
+		printf("int (scaled): %d\n", a);
+	}
+	else if(argv[1][0] == 'S'){
+		Int a(1), b(2), c(3);
+		for(int i=0; i<n; ++i){
+			Int tmp = b*type_builder::scale<std::ratio<7, 2>>{};
+			a += tmp + (c+c);
+			c = c+c;
+			b *=2;
+			a %= 10000;
+			b %= 20000;
+			c %= 12345;
+		}
+		printf("Int (scaled): %d\n", a.get_value());
+	}
+	else if(argv[1][0] == 'd' || argv[1][0] == 'D'){
+		// the loop of 'I' with moduli that are only known at runtime, like a
+		// configured bucket-size (argv[1][1] is the terminating zero):
+		const int m1(10000 + argv[1][1]), m2(20000 + argv[1][1]), m3(12345 + argv[1][1]);
+		const type_builder::divisor<int> d1{m1}, d2{m2}, d3{m3};
+		Int a(1), b(2), c(3);
+		for(int i=0; i<n; ++i){
+			Int tmp = b*3.5;
+			a += tmp + (c+c);
+			c = c+c;
+			b *=2;
+			if(argv[1][0] == 'd'){
+				a %= m1;
+				b %= m2;
+				c %= m3;
+			}
+			else{
+				a %= d1;
+				b %= d2;
+				c %= d3;
+			}
+		}
+		printf("Int (runtime moduli): %d\n", a.get_value());
+	}
 	else return 2;
 }
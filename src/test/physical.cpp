@@ -8,19 +8,19 @@
 using meter_per_second = decltype(std::declval<meter>() / std::declval<second>());
 using square_meter = decltype(std::declval<meter>() * std::declval<meter>());
 
-meter_per_second operator"" _mps(long double val){
+constexpr meter_per_second operator"" _mps(long double val){
 	return meter_per_second{val};
 }
 
-square_meter operator"" _m2(long double val){
+constexpr square_meter operator"" _m2(long double val){
 	return square_meter{val};
 }
 
-meter operator"" _m(long double val){
+constexpr meter operator"" _m(long double val){
 	return meter{val};
 }
 
-second operator"" _s(long double val){
+constexpr second operator"" _s(long double val){
 	return second{val};
 }
 
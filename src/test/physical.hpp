@@ -52,10 +52,10 @@ public:
 				returnstring += unit.second;
 			}
 			else if(unit.first == 2){
-				returnstring += unit.second + u8"²";
+				returnstring += unit.second + "\u00b2";
 			}
 			else if(unit.first == 3){
-				returnstring += unit.second + u8"³";
+				returnstring += unit.second + "\u00b3";
 			}
 			else if(unit.first != 0){
 				returnstring += unit.second + "^" + to_string(unit.first);
@@ -101,7 +101,7 @@ using physical = type_builder::basic_number<T, physical_t<Tm, Tkg, Ts, TA, TK, T
 
 template<int Tm1, int Tkg1, int Ts1, int TA1, int TK1, int Tmol1, int Tcd1, typename T1,
 	int Tm2, int Tkg2, int Ts2, int TA2, int TK2, int Tmol2, int Tcd2, typename T2>
-physical<Tm1+Tm2, Tkg1+Tkg2, Ts1+Ts2, TA1+TA2, TK1+TK2, Tmol1+Tmol2, Tcd1+Tcd2,
+constexpr physical<Tm1+Tm2, Tkg1+Tkg2, Ts1+Ts2, TA1+TA2, TK1+TK2, Tmol1+Tmol2, Tcd1+Tcd2,
 	decltype(std::declval<T1>()*std::declval<T2>())>
 operator*(const physical<Tm1,Tkg1, Ts1, TA1, TK1, Tmol1, Tcd1, T1>& a,
 		const physical<Tm2,Tkg2, Ts2, TA2, TK2, Tmol2, Tcd2, T2>& b){
@@ -110,7 +110,7 @@ operator*(const physical<Tm1,Tkg1, Ts1, TA1, TK1, Tmol1, Tcd1, T1>& a,
 
 template<int Tm1, int Tkg1, int Ts1, int TA1, int TK1, int Tmol1, int Tcd1, typename T1,
 	int Tm2, int Tkg2, int Ts2, int TA2, int TK2, int Tmol2, int Tcd2, typename T2>
-physical<Tm1-Tm2, Tkg1-Tkg2, Ts1-Ts2, TA1-TA2, TK1-TK2, Tmol1-Tmol2, Tcd1-Tcd2,
+constexpr physical<Tm1-Tm2, Tkg1-Tkg2, Ts1-Ts2, TA1-TA2, TK1-TK2, Tmol1-Tmol2, Tcd1-Tcd2,
 	decltype(std::declval<T1>()/std::declval<T2>())> 
 operator/(const physical<Tm1,Tkg1, Ts1, TA1, TK1, Tmol1, Tcd1, T1>& a,
 		const physical<Tm2,Tkg2, Ts2, TA2, TK2, Tmol2, Tcd2, T2>& b){
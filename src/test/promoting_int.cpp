@@ -0,0 +1,147 @@
+#include "../include/promoting_int.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+using type_builder::promoting_int;
+using P = promoting_int<>;
+using P_sat = promoting_int<type_builder::saturate_on_error>;
+using I32 = type_builder::safe_int<std::int32_t>;
+using I64 = type_builder::safe_int<std::int64_t>;
+
+#define ASSERT_THROW_EX(expr, exception) \
+	do{ try{ expr; assert(false); } catch (exception& e){ assert(true); } }while(false)
+
+const std::int64_t max = std::numeric_limits<std::int64_t>::max();
+const std::int64_t min = std::numeric_limits<std::int64_t>::min();
+
+P factorial(int n){
+	P result{1};
+	for(int i = 2; i <= n; ++i){
+		result *= i;
+	}
+	return result;
+}
+
+#ifdef TYPE_BUILDER_HAS_INT128
+using type_builder::int128_t;
+
+std::string to_string(int128_t value){
+	const bool negative = value < 0;
+	type_builder::uint128_t magnitude = negative ?
+		type_builder::uint128_t{0} - static_cast<type_builder::uint128_t>(value) :
+		static_cast<type_builder::uint128_t>(value);
+	std::string result;
+	do{
+		result.insert(result.begin(), static_cast<char>('0' + magnitude % 10));
+		magnitude /= 10;
+	}while(magnitude != 0);
+	return negative ? "-" + result : result;
+}
+
+// compares the operations with the ones of int128 around the bounds of int64:
+void test_against_int128(){
+	std::mt19937_64 engine{42};
+	const std::int64_t interesting[] = {0, 1, -1, 2, -2, 3, max, min, max - 1, min + 1,
+		max / 2, min / 2, std::int64_t{1} << 32, -(std::int64_t{1} << 32), 1000000007};
+	std::vector<int128_t> values;
+	for(auto value: interesting){
+		values.push_back(value);
+	}
+	for(int i = 0; i < 40; ++i){
+		values.push_back(static_cast<std::int64_t>(engine()) >> (engine() % 64));
+	}
+	for(auto lhs: values){
+		for(auto rhs: values){
+			const P l{lhs};
+			const P r{rhs};
+			assert((l + r).to_string() == to_string(lhs + rhs));
+			assert((l - r).to_string() == to_string(lhs - rhs));
+			assert((l * r).to_string() == to_string(lhs * rhs));
+			assert((l < r) == (lhs < rhs));
+			assert((l == r) == (lhs == rhs));
+			assert((l + r).is_small() == (lhs + rhs >= min && lhs + rhs <= max));
+			if(rhs != 0){
+				assert((l / r).to_string() == to_string(lhs / rhs));
+				assert((l % r).to_string() == to_string(lhs % rhs));
+			}
+			// with promoted operands:
+			const int128_t big = int128_t{max} * 3 + rhs;
+			const P b = P{max} * 3 + r;
+			assert(!b.is_small());
+			assert((b + l).to_string() == to_string(big + lhs));
+			assert((b - l).to_string() == to_string(big - lhs));
+			assert((b > l) == (big > lhs));
+			assert(b.narrow<int128_t>() == type_builder::safe_int<int128_t>{big});
+			if(lhs != 0){
+				assert((b / l).to_string() == to_string(big / lhs));
+				assert((b % l).to_string() == to_string(big % lhs));
+			}
+			assert((b / b) == P{1});
+			assert((b - b).is_small());
+		}
+	}
+}
+#endif
+
+int main(){
+#ifdef TYPE_BUILDER_HAS_INT128
+	test_against_int128();
+#endif
+
+	assert(factorial(20).is_small());
+	assert(factorial(20) == P{2432902008176640000});
+	assert(factorial(30).to_string() == "265252859812191058636308480000000");
+	assert((-factorial(25)).to_string() == "-15511210043330985984000000");
+	assert(factorial(30) / factorial(28) == P{30 * 29});
+	assert(factorial(30) % factorial(29) == P{0});
+	assert((factorial(40) / (factorial(30) * factorial(10))).to_string() == "847660528");
+
+	// values that fit into a word again are demoted:
+	P value{max};
+	++value;
+	assert(!value.is_small());
+	assert(value.to_string() == "9223372036854775808");
+	--value;
+	assert(value.is_small() && value == P{max});
+	assert((-P{min}).to_string() == "9223372036854775808");
+	assert((-(-P{min})).is_small());
+	assert(P{min} / -1 == -P{min});
+	assert(P{min} % -1 == P{0});
+	assert(P{std::numeric_limits<std::uint64_t>::max()}.to_string() == "18446744073709551615");
+
+	// conversions back into safe_int:
+	assert(P{I32{-5}} * I32{7} == P{-35});
+	assert(value.narrow<std::int64_t>() == I64{max});
+	assert(static_cast<I32>(P{1000}) == I32{1000});
+	ASSERT_THROW_EX(P{max}.narrow<std::int32_t>(), std::out_of_range);
+	ASSERT_THROW_EX((P{max} + 1).narrow<std::int64_t>(), std::out_of_range);
+	ASSERT_THROW_EX(P{1} / 0, std::domain_error);
+	ASSERT_THROW_EX(P{1} % 0, std::domain_error);
+	assert((P_sat{max} * 2).narrow<std::int64_t>() == (type_builder::safe_int<std::int64_t,
+		type_builder::saturate_on_error>{max}));
+	assert(P_sat{-3} / 0 == P_sat{min});
+	assert(P_sat{-3} % 0 == P_sat{-3});
+	assert((P_sat{max} * 4 % 0).to_string() == "36893488147419103228");
+
+	// copies own their blocks:
+	P copy = factorial(30);
+	P other = copy;
+	other += 1;
+	assert(other - copy == P{1});
+	copy = other;
+	assert(copy == other);
+
+	std::ostringstream stream;
+	stream << factorial(21) << ' ' << P{-12};
+	assert(stream.str() == "51090942171709440000 -12");
+}
@@ -0,0 +1,97 @@
+#include "../include/safe_accumulator.hpp"
+
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+using I08 = type_builder::safe_int<std::int8_t>;
+using U08 = type_builder::safe_int<std::uint8_t>;
+using I32 = type_builder::safe_int<std::int32_t>;
+using I64 = type_builder::safe_int<std::int64_t>;
+using I32_sat = type_builder::safe_int<std::int32_t, type_builder::saturate_on_error>;
+
+using type_builder::checked_sum;
+using type_builder::checked_dot;
+
+static_assert(std::is_same<type_builder::safe_accumulator<std::int32_t>::register_type, std::int64_t>::value, "");
+static_assert(std::is_same<type_builder::safe_accumulator<std::uint8_t>::register_type, std::uint16_t>::value, "");
+static_assert(std::is_same<type_builder::safe_dot_accumulator<std::int16_t>::register_type, std::int64_t>::value, "");
+
+#define ASSERT_THROW_EX(expr, exception) \
+	do{ try{ expr; assert(false); } catch (exception& e){ assert(true); } }while(false)
+
+int main(){
+	const std::int32_t max = std::numeric_limits<std::int32_t>::max();
+	const std::int32_t min = std::numeric_limits<std::int32_t>::min();
+	
+	std::vector<I32> values;
+	for(int i = 0; i < 1000; ++i){
+		values.push_back(I32(i));
+	}
+	assert(checked_sum(values) == I32(999 * 1000 / 2));
+	assert(checked_dot(values, values) == I32(999 * 1000 * 1999 / 6));
+	
+	// only the final result is checked:
+	values.assign({I32(max), I32(max), I32(-max), I32(-max), I32(7)});
+	assert(checked_sum(values) == I32(7));
+	values.push_back(I32(max));
+	ASSERT_THROW_EX(checked_sum(values), std::overflow_error);
+	values.assign({I32(min), I32(-1)});
+	ASSERT_THROW_EX(checked_sum(values), std::underflow_error);
+	
+	type_builder::safe_accumulator<std::int32_t> acc;
+	acc += I32(max);
+	acc += I32(1);
+	assert(acc.get_register() == std::int64_t{max} + 1);
+	ASSERT_THROW_EX(acc.get(), std::overflow_error);
+	acc += I32(-2);
+	assert(static_cast<I32>(acc) == I32(max - 1));
+	
+	// merging accumulators:
+	type_builder::safe_accumulator<std::int32_t> other;
+	other += type_builder::span<const I32>{values};
+	acc += other;
+	assert(acc.get() == I32(max - 1) + I32(min) + I32(-1));
+	
+	// products are exact:
+	std::vector<I32> lhs{I32(max), I32(max)}, rhs{I32(max), I32(-max)};
+	assert(checked_dot(lhs, rhs) == I32(0));
+	ASSERT_THROW_EX(checked_dot(lhs, std::vector<I32>(1)), std::length_error);
+	
+	type_builder::safe_dot_accumulator<std::int32_t> dot;
+	dot.add(I32(65536), I32(65536));
+	ASSERT_THROW_EX(dot.get(), std::overflow_error);
+	dot.add(I32(-65536), I32(65535));
+	assert(dot.get() == I32(65536));
+	
+	// small types use up their budget and are checked from then on:
+	std::vector<I08> bytes(300, I08(100));
+	type_builder::safe_accumulator<std::int8_t> small;
+	small += type_builder::span<const I08>{bytes};
+	assert(small.get_register() == 30000);
+	for(int i = 0; i < 27; ++i){
+		small += I08(100);
+	}
+	assert(small.get_register() == 32700);
+	ASSERT_THROW_EX(small += I08(100), std::overflow_error);
+	std::vector<U08> ubytes(300, U08(255));
+	ASSERT_THROW_EX(checked_sum(ubytes), std::overflow_error);
+	
+	// policies:
+	std::vector<I32_sat> saturated(3, I32_sat(max));
+	assert(checked_sum(saturated) == I32_sat(max));
+	
+	// 64 bit values are summed in 128 bits, their products are checked in 128 bits:
+	const std::int64_t max64 = std::numeric_limits<std::int64_t>::max();
+	std::vector<I64> big{I64(max64), I64(max64), I64(-max64), I64(-3)};
+	assert(checked_sum(big) == I64(max64 - 3));
+	assert(checked_dot(std::vector<I64>(2, I64(max64)), std::vector<I64>{I64(max64), I64(-max64)}) == I64(0));
+	ASSERT_THROW_EX(checked_dot(std::vector<I64>(3, I64(max64)), std::vector<I64>(3, I64(max64))),
+		std::overflow_error);
+}
@@ -1,4 +1,5 @@
 #include "../include/safe_int.hpp"
+#include "../include/widening_safe_int.hpp"
 
 #include <cstdlib>
 #include <iostream>
@@ -21,10 +22,21 @@ using I08 = ui<std::int8_t>;
 using I16 = ui<std::int16_t>;
 using I32 = ui<std::int32_t>;
 using I64 = ui<std::int64_t>;
+using I128 = ui<type_builder::int128_t>;
+using U128 = ui<type_builder::uint128_t>;
 
 using U = ui<unsigned int>;
 using I = ui<int>;
 
+using I08_sat = type_builder::safe_int<std::int8_t, type_builder::saturate_on_error>;
+using U08_sat = type_builder::safe_int<std::uint8_t, type_builder::saturate_on_error>;
+using I08_wrap = type_builder::safe_int<std::int8_t, type_builder::wrap_on_error>;
+using U08_wrap = type_builder::safe_int<std::uint8_t, type_builder::wrap_on_error>;
+using I_poison = type_builder::safe_int<int, type_builder::poison_on_error>;
+
+using WU08 = type_builder::widening_safe_int<std::uint8_t>;
+using WI64 = type_builder::widening_safe_int<std::int64_t>;
+
 #define ASSERT_THROW(expr) \
 	do{ try{ expr; assert(false); } catch (std::exception& e){ assert(true); } }while(false)
 
@@ -71,6 +83,9 @@ int main(){
 	assert(u08_128 > i08__1);
 	assert(u08_255 > i08__128);
 	assert(!(u08_255 == i08__128));
+	assert(i08_127 == u08_127);
+	assert(!(i08__1 == u08_255));
+	assert(I08(5) == I16(5));
 
 	ASSERT_THROW(u08_255 + i08_1);
 	ASSERT_THROW(u08_255 + i08__1);
@@ -145,6 +160,54 @@ int main(){
 	stream << i16_0 << std::endl;
 	assert(stream.str() == "0\n");
 	
+	// 128 bit integers:
+	const I128 i128_max{std::numeric_limits<type_builder::int128_t>::max()};
+	const I128 i128_min{std::numeric_limits<type_builder::int128_t>::min()};
+	const U128 u128_max{std::numeric_limits<type_builder::uint128_t>::max()};
+	ASSERT_THROW_EX(i128_max + I128(1), std::overflow_error);
+	ASSERT_THROW_EX(i128_min - I128(1), std::underflow_error);
+	ASSERT_THROW_EX(I128(INT64_MAX) * I128(INT64_MAX) * I128(4), std::overflow_error);
+	ASSERT_THROW_EX(u128_max * U128(2), std::overflow_error);
+	assert(-(i128_min + I128(1)) == i128_max);
+	assert(U128(U64(UINT64_MAX)) * U128(U64(UINT64_MAX)) < u128_max);
+	stream.str("");
+	stream << i128_max << ' ' << i128_min << ' ' << u128_max << ' ' << I128(-5) << ' ' << U128(0);
+	assert(stream.str() == "170141183460469231731687303715884105727 "
+		"-170141183460469231731687303715884105728 "
+		"340282366920938463463374607431768211455 -5 0");
+	I128 i128_read;
+	U128 u128_read;
+	stream >> i128_read;
+	assert(i128_read == i128_max);
+	stream >> i128_read;
+	assert(i128_read == i128_min);
+	stream >> u128_read;
+	assert(u128_read == u128_max);
+	stream >> i128_read >> u128_read;
+	assert(i128_read == I128(-5) && u128_read == U128(0));
+	std::stringstream bad_stream{"340282366920938463463374607431768211456 -1 12a"};
+	bad_stream >> u128_read;
+	assert(bad_stream.fail());
+	bad_stream.clear();
+	bad_stream >> u128_read;
+	assert(bad_stream.fail());
+	bad_stream.clear();
+	bad_stream >> i128_read;
+	assert(bad_stream.fail());
+	std::stringstream long_stream{std::string(70, '0') + "1"};
+	long_stream >> u128_read;
+	assert(long_stream.fail());
+	
+	// mixed 64 bit integers are compared and combined in 128 bits:
+	const U64 u64_max{UINT64_MAX};
+	const I64 i64__1{-1}, i64_min{INT64_MIN};
+	assert(u64_max > i64__1);
+	assert(!(u64_max == i64__1));
+	assert(i64_min < u64_max);
+	assert(u64_max + i64__1 == U64(UINT64_MAX - 1));
+	assert(u64_max - i64_min == I128(UINT64_MAX) + I128(INT64_MAX) + I128(1));
+	assert(I128(type_builder::impl::checked_cast<type_builder::int128_t>(UINT64_MAX)) == I128(u64_max));
+	
 	ASSERT_THROW(I(INT_MIN) * I(INT_MIN););
 	ASSERT_THROW(I(INT_MIN) * I(INT_MAX););
 	ASSERT_THROW(I(INT_MAX) * I(INT_MIN););
@@ -152,5 +215,65 @@ int main(){
 	
 	ASSERT_THROW(U(UINT_MAX) * I(INT_MIN););
 	ASSERT_THROW(U(UINT_MAX) * I(INT_MAX););
+	ASSERT_THROW_EX(I(INT_MIN) / I(-1), std::overflow_error);
+	ASSERT_NOTHROW(I(INT_MIN) % I(-1));
+	assert(I(INT_MIN) % I(-1) == I(0));
+	ASSERT_THROW_EX(I(1) % I(0), std::domain_error);
+	ASSERT_THROW_EX(I(1) << 40, std::domain_error);
+	
+	// error-policies:
+	const I08_sat i08_sat_100{static_cast<std::int8_t>(100)}, i08_sat__100{static_cast<std::int8_t>(-100)};
+	assert((i08_sat_100 + i08_sat_100).get_value() == 127);
+	assert((i08_sat__100 + i08_sat__100).get_value() == -128);
+	assert((i08_sat_100 - i08_sat__100).get_value() == 127);
+	assert((i08_sat_100 * i08_sat__100).get_value() == -128);
+	assert((i08_sat__100 * i08_sat__100).get_value() == 127);
+	assert((i08_sat__100 / I08_sat{}).get_value() == -128);
+	assert((-I08_sat{static_cast<std::int8_t>(-128)}).get_value() == 127);
+	assert(I08_sat{1000}.get_value() == 127);
+	assert(I08_sat{-1000}.get_value() == -128);
+	assert((U08_sat{} - U08_sat{static_cast<std::uint8_t>(1)}).get_value() == 0);
+	assert((U08_sat{static_cast<std::uint8_t>(200)} + I08_sat{static_cast<std::int8_t>(1)}).get_value() == 127);
+	{
+		auto tmp = U08_sat{static_cast<std::uint8_t>(255)};
+		++tmp;
+		assert(tmp.get_value() == 255);
+	}
+	
+	const I08_wrap i08_wrap_100{static_cast<std::int8_t>(100)};
+	assert((i08_wrap_100 + i08_wrap_100).get_value() == -56);
+	assert((i08_wrap_100 * i08_wrap_100).get_value() == 16);
+	assert((U08_wrap{} - U08_wrap{static_cast<std::uint8_t>(1)}).get_value() == 255);
+	assert(U08_wrap{1000}.get_value() == 232);
+	{
+		auto tmp = I08_wrap{static_cast<std::int8_t>(127)};
+		tmp++;
+		assert(tmp.get_value() == -128);
+	}
+	
+	type_builder::poison_on_error::clear();
+	I_poison sum{0};
+	for(int i = 0; i < 4; ++i){
+		sum += I_poison{INT_MAX / 2};
+	}
+	assert(type_builder::poison_on_error::is_poisoned());
+	ASSERT_THROW_EX(type_builder::poison_on_error::check(), std::range_error);
+	assert(!type_builder::poison_on_error::is_poisoned());
+	ASSERT_NOTHROW(type_builder::poison_on_error::check());
+	
+	// widening:
+	const WU08 wu08_200{static_cast<std::uint8_t>(200)}, wu08_100{static_cast<std::uint8_t>(100)};
+	const auto widened = wu08_200 * wu08_200 + wu08_100 - wu08_200;
+	assert(widened.get_value() == 39900);
+	ASSERT_THROW_EX(widened.narrow<std::uint8_t>(), std::out_of_range);
+	ASSERT_NOTHROW(widened.narrow<std::uint16_t>());
+	assert(static_cast<U16>(widened) == U16(39900));
+	assert(static_cast<U08>(wu08_100 - wu08_200 + wu08_200) == u08_0 + U08(100));
+	assert(wu08_100 - wu08_200 < wu08_100);
+	assert((WI64{INT64_MAX} * WI64{INT64_MAX}).get_value() == type_builder::int128_t{INT64_MAX} * INT64_MAX);
+	ASSERT_THROW_EX((WI64{INT64_MAX} * WI64{INT64_MAX}).narrow<std::int64_t>(), std::out_of_range);
+	const auto wi128_max = WI64{INT64_MAX} * WI64{INT64_MAX} * WI64{2};
+	ASSERT_THROW(wi128_max + wi128_max);
+	ASSERT_NOTHROW(wi128_max - wi128_max);
 }
 
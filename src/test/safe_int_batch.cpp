@@ -0,0 +1,285 @@
+#include "../include/safe_int_batch.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+using I08 = type_builder::safe_int<std::int8_t>;
+using I08_sat = type_builder::safe_int<std::int8_t, type_builder::saturate_on_error>;
+using I16 = type_builder::safe_int<std::int16_t>;
+using I16_sat = type_builder::safe_int<std::int16_t, type_builder::saturate_on_error>;
+using U16 = type_builder::safe_int<std::uint16_t>;
+using U32 = type_builder::safe_int<std::uint32_t>;
+using I32 = type_builder::safe_int<std::int32_t>;
+using I64 = type_builder::safe_int<std::int64_t>;
+using I32_sat = type_builder::safe_int<std::int32_t, type_builder::saturate_on_error>;
+using I32_poison = type_builder::safe_int<std::int32_t, type_builder::poison_on_error>;
+
+// saturates and keeps the message of the last error:
+struct record_on_error{
+	static std::string last;
+	template<typename Texception, typename T>
+	static T on_error(T saturated, T, const char* what){
+		last = what;
+		return saturated;
+	}
+};
+std::string record_on_error::last;
+using I32_record = type_builder::safe_int<std::int32_t, record_on_error>;
+
+using type_builder::checked_add;
+using type_builder::checked_sub;
+using type_builder::checked_mul;
+using type_builder::checked_negate;
+using type_builder::checked_convert;
+using type_builder::make_span;
+
+struct add_op{
+	template<typename T> T operator()(T lhs, T rhs) const { return lhs + rhs; }
+};
+struct sub_op{
+	template<typename T> T operator()(T lhs, T rhs) const { return lhs - rhs; }
+};
+struct mul_op{
+	template<typename T> T operator()(T lhs, T rhs) const { return lhs * rhs; }
+};
+
+template<typename Tbatch, typename Tscalar>
+void compare_i08(Tbatch batch, Tscalar scalar){
+	std::vector<I08_sat> lhs, rhs;
+	for(int l = -128; l < 128; ++l){
+		for(int r = -128; r < 128; ++r){
+			lhs.push_back(I08_sat(l));
+			rhs.push_back(I08_sat(r));
+		}
+	}
+	std::vector<I08_sat> out(lhs.size());
+	std::unique_ptr<bool[]> mask{new bool[lhs.size()]};
+	const auto result = batch(lhs, rhs, make_span(out), make_span(mask.get(), lhs.size()));
+	std::size_t errors = 0;
+	for(std::size_t i = 0; i < lhs.size(); ++i){
+		assert(out[i] == scalar(lhs[i], rhs[i]));
+		bool failed = false;
+		try{ scalar(I08(lhs[i].get_value()), I08(rhs[i].get_value())); }
+		catch(std::exception&){ failed = true; }
+		assert(mask[i] == failed);
+		if(failed && errors++ == 0){
+			assert(result.first_error == i);
+		}
+	}
+	assert(errors > 0);
+	assert(result.errors == errors);
+}
+
+// compares the batch-operations with the scalar operators for every pair of int8-values:
+void test_exhaustive_i08(){
+	compare_i08(
+		[](type_builder::span<const I08_sat> l, type_builder::span<const I08_sat> r,
+			type_builder::span<I08_sat> o, type_builder::span<bool> m){ return checked_add(l, r, o, m); },
+		add_op{});
+	compare_i08(
+		[](type_builder::span<const I08_sat> l, type_builder::span<const I08_sat> r,
+			type_builder::span<I08_sat> o, type_builder::span<bool> m){ return checked_sub(l, r, o, m); },
+		sub_op{});
+	compare_i08(
+		[](type_builder::span<const I08_sat> l, type_builder::span<const I08_sat> r,
+			type_builder::span<I08_sat> o, type_builder::span<bool> m){ return checked_mul(l, r, o, m); },
+		mul_op{});
+}
+
+// compares the bulk-conversions with the converting constructor:
+void test_conversions(){
+	std::vector<std::int64_t> ints;
+	for(std::int64_t i = -70000; i <= 70000; i += 7){
+		ints.push_back(i);
+	}
+	ints.push_back(std::numeric_limits<std::int64_t>::min());
+	ints.push_back(std::numeric_limits<std::int64_t>::max());
+	ints.push_back(std::int64_t{1} << 32);
+	std::vector<I16_sat> out(ints.size());
+	std::unique_ptr<bool[]> mask{new bool[ints.size()]};
+	auto result = checked_convert(ints, make_span(out), make_span(mask.get(), ints.size()));
+	std::size_t errors = 0;
+	for(std::size_t i = 0; i < ints.size(); ++i){
+		assert(out[i] == I16_sat(ints[i]));
+		const bool failed = ints[i] < -32768 || ints[i] > 32767;
+		assert(mask[i] == failed);
+		if(failed && errors++ == 0){
+			assert(result.first_error == i);
+		}
+	}
+	assert(result.errors == errors);
+	
+	const std::vector<std::int64_t> some_ints = {1, 2, 100000, 3};
+	std::vector<I16> checked(some_ints.size());
+	try{ checked_convert(some_ints, make_span(checked)); assert(false); }
+	catch(std::out_of_range& e){
+		assert(std::strstr(e.what(), "index 2"));
+	}
+	assert(checked[1] == I16(2));
+	assert(checked[3] == I16(0));
+	
+	// unsigned sources and targets:
+	const std::uint32_t unsigned_values[] = {0, 5, 65535, 65536, 4294967295u};
+	std::vector<U16> u_out(5);
+	bool u_mask[5] = {};
+	try{ checked_convert(type_builder::make_span(unsigned_values, 5), make_span(u_out), u_mask); assert(false); }
+	catch(std::out_of_range&){}
+	assert(u_out[2] == U16(65535));
+	assert(!u_mask[2] && u_mask[3] && u_mask[4]);
+	const std::int32_t negative[] = {1, -1};
+	try{ checked_convert(type_builder::make_span(negative, 2), make_span(u_out).subspan(0, 2)); assert(false); }
+	catch(std::out_of_range&){}
+	
+	// floating point values:
+	const double doubles[] = {0.0, -0.0, 1.0, -32768.0, 32767.0, 32768.0, -32769.0, 0.5, -2.25,
+		std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::infinity(),
+		-std::numeric_limits<double>::infinity(), 1e300, 12345.0};
+	const bool fails[] = {false, false, false, false, false, true, true, true, true,
+		true, true, true, true, false};
+	const std::int16_t saturated[] = {0, 0, 1, -32768, 32767, 32767, -32768, 0, -2,
+		0, 32767, -32768, 32767, 12345};
+	const std::size_t count = sizeof(doubles) / sizeof(doubles[0]);
+	std::vector<I16_sat> from_double(count);
+	bool d_mask[count] = {};
+	result = checked_convert(type_builder::make_span(doubles, count), make_span(from_double), d_mask);
+	assert(result.first_error == 5);
+	assert(result.errors == 8);
+	for(std::size_t i = 0; i < count; ++i){
+		assert(d_mask[i] == fails[i]);
+		assert(from_double[i] == I16_sat(saturated[i]));
+	}
+	
+	// the boundaries of 64 bit integers are exact in floats:
+	assert(checked_convert<std::int64_t>(-9223372036854775808.0f) == I64(std::numeric_limits<std::int64_t>::min()));
+	try{ checked_convert<std::int64_t>(9223372036854775808.0); assert(false); }
+	catch(std::out_of_range&){}
+	try{ checked_convert<std::int32_t>(0.1f); assert(false); }
+	catch(std::domain_error&){}
+	try{ checked_convert<std::int32_t>(std::numeric_limits<float>::quiet_NaN()); assert(false); }
+	catch(std::domain_error&){}
+	try{ checked_convert<std::uint32_t>(-1.0); assert(false); }
+	catch(std::out_of_range&){}
+	assert(checked_convert<std::int32_t>(std::int64_t{-5}) == I32(-5));
+	assert((checked_convert<std::int8_t, type_builder::saturate_on_error>(300) == I08_sat(127)));
+	
+	// elements of the same size can be converted in place:
+	std::vector<std::int32_t> column(1000, 7);
+	column[500] = -1;
+	const type_builder::span<U32> retyped{reinterpret_cast<U32*>(column.data()), column.size()};
+	try{ checked_convert(column, retyped); assert(false); }
+	catch(std::out_of_range&){}
+	assert(retyped[499] == U32(7u));
+	
+	try{ checked_convert(ints, make_span(out).subspan(0, 3)); assert(false); }
+	catch(std::length_error&){}
+}
+
+int main(){
+	test_exhaustive_i08();
+	test_conversions();
+	
+	std::vector<I32> lhs, rhs;
+	for(int i = 0; i < 1000; ++i){
+		lhs.push_back(I32(i * 1000));
+		rhs.push_back(I32(-i));
+	}
+	std::vector<I32> out(lhs.size());
+	
+	auto result = checked_add(lhs, rhs, make_span(out));
+	assert(result.ok());
+	assert(result.first_error == lhs.size());
+	for(std::size_t i = 0; i < lhs.size(); ++i){
+		assert(out[i] == lhs[i] + rhs[i]);
+	}
+	assert(checked_sub(lhs, rhs, make_span(out)).ok());
+	assert(out[999] == I32(999000 + 999));
+	assert(checked_mul(lhs, rhs, make_span(out)).ok());
+	assert(out[999] == I32(-999 * 999000));
+	assert(checked_negate<std::int32_t>(lhs, make_span(out)).ok());
+	assert(out[999] == I32(-999000));
+	
+	// in place:
+	assert(checked_add(out, rhs, make_span(out)).ok());
+	assert(out[999] == I32(-999000 - 999));
+	
+	// the first error is reported with its index, the elements before it are set:
+	lhs[700] = I32(std::numeric_limits<std::int32_t>::max());
+	rhs[700] = I32(1);
+	lhs[900] = I32(std::numeric_limits<std::int32_t>::min());
+	out.assign(out.size(), I32(0));
+	try{
+		checked_add(lhs, rhs, make_span(out));
+		assert(false);
+	}
+	catch(std::overflow_error& e){
+		assert(std::strstr(e.what(), "700"));
+	}
+	assert(out[699] == lhs[699] + rhs[699]);
+	assert(out[701] == I32(0));
+	try{
+		checked_negate<std::int32_t>(std::vector<I32>(lhs.begin() + 800, lhs.end()), make_span(out).subspan(0, 200));
+		assert(false);
+	}
+	catch(std::overflow_error& e){
+		assert(std::strstr(e.what(), "100"));
+	}
+	
+	// other policies see every failing element:
+	std::vector<I32_sat> lhs_sat(lhs.begin(), lhs.end()), rhs_sat(rhs.begin(), rhs.end()), out_sat(lhs.size());
+	for(std::size_t i = 0; i < lhs.size(); ++i){
+		lhs_sat[i] = I32_sat(lhs[i].get_value());
+		rhs_sat[i] = I32_sat(rhs[i].get_value());
+	}
+	rhs_sat[900] = I32_sat(-1);
+	result = checked_add(lhs_sat, rhs_sat, make_span(out_sat));
+	assert(!result.ok());
+	assert(result.first_error == 700);
+	assert(result.errors == 2);
+	assert(out_sat[700] == I32_sat(std::numeric_limits<std::int32_t>::max()));
+	assert(out_sat[900] == I32_sat(std::numeric_limits<std::int32_t>::min()));
+	assert(out_sat[999] == lhs_sat[999] + rhs_sat[999]);
+	
+	// and the message of each, even if it is in a later block than the first one:
+	std::vector<I32_record> lhs_rec(lhs.size()), rhs_rec(lhs.size()), out_rec(lhs.size());
+	for(std::size_t i = 0; i < lhs.size(); ++i){
+		lhs_rec[i] = I32_record(lhs_sat[i].get_value());
+		rhs_rec[i] = I32_record(rhs_sat[i].get_value());
+	}
+	assert(checked_add(lhs_rec, rhs_rec, make_span(out_rec)).errors == 2);
+	assert(record_on_error::last == "safe_int batch-operation failed at index 900");
+	
+	std::vector<I32_poison> poisoned(3, I32_poison(std::numeric_limits<std::int32_t>::max()));
+	type_builder::poison_on_error::clear();
+	result = checked_mul(poisoned, poisoned, make_span(poisoned));
+	assert(result.errors == 3);
+	assert(type_builder::poison_on_error::is_poisoned());
+	type_builder::poison_on_error::clear();
+	
+	// 64 bit multiplications are checked in 128 bits:
+	std::vector<I64> big(2, I64(std::int64_t{1} << 32)), big_out(2);
+	big[1] = I64(std::int64_t{1} << 30);
+	bool mask[2] = {};
+	try{ checked_mul(big, big, make_span(big_out), mask); assert(false); }
+	catch(std::overflow_error&){}
+	assert(mask[0] && !mask[1]);
+	
+	// unsigned:
+	std::vector<U16> u(2, U16(1)), u_out(2);
+	u[1] = U16(0);
+	try{ checked_sub(u, std::vector<U16>(2, U16(1)), make_span(u_out)); assert(false); }
+	catch(std::underflow_error&){}
+	assert(u_out[0] == U16(0));
+	
+	try{ checked_add(u, std::vector<U16>(3), make_span(u_out)); assert(false); }
+	catch(std::length_error&){}
+}
@@ -0,0 +1,128 @@
+#include "../include/safe_int_constant.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+using I08 = type_builder::safe_int<std::int8_t>;
+using U08 = type_builder::safe_int<std::uint8_t>;
+using I32 = type_builder::safe_int<std::int32_t>;
+using I64 = type_builder::safe_int<std::int64_t>;
+using U32 = type_builder::safe_int<std::uint32_t>;
+using I08_sat = type_builder::safe_int<std::int8_t, type_builder::saturate_on_error>;
+using U08_sat = type_builder::safe_int<std::uint8_t, type_builder::saturate_on_error>;
+using I08_wrap = type_builder::safe_int<std::int8_t, type_builder::wrap_on_error>;
+
+template<std::int8_t Tvalue>
+using c08 = type_builder::safe_int_constant<std::int8_t, Tvalue>;
+template<std::uint8_t Tvalue>
+using cu08 = type_builder::safe_int_constant<std::uint8_t, Tvalue>;
+
+using namespace type_builder::literals;
+
+#define ASSERT_THROW_EX(expr, exception) \
+	do{ try{ expr; assert(false); } catch (exception& e){ assert(true); } }while(false)
+
+// the bounds and the results are computed at compile-time:
+static_assert(std::is_same<decltype(1000_c), type_builder::safe_int_constant<int, 1000>>::value, "");
+static_assert(std::is_same<decltype(-3_c), type_builder::safe_int_constant<int, -3>>::value, "");
+static_assert(std::is_same<decltype(3000000000_c), type_builder::safe_int_constant<long, 3000000000>>::value, "");
+static_assert((I32{7} * 3_c).get_value() == 21, "");
+static_assert((I32{7} / -2_c).get_value() == -3, "");
+static_assert((I32{7} % 4_c).get_value() == 3, "");
+static_assert((I32{7} - 10_c).get_value() == -3, "");
+static_assert((I32{7} + 10_c).get_value() == 17, "");
+static_assert((10_c - I32{7}).get_value() == 3, "");
+static_assert((I08_sat{std::int8_t{100}} * c08<2>{}).get_value() == 127, "");
+static_assert((I08_sat{std::int8_t{100}} * c08<-2>{}).get_value() == -128, "");
+static_assert((I08_wrap{std::int8_t{100}} + c08<100>{}).get_value() == -56, "");
+static_assert(std::is_same<decltype(std::declval<I08>() * 3_c), I32>::value, "");
+static_assert(std::is_same<decltype(std::declval<I08>() * c08<3>{}), I08>::value, "");
+static_assert(std::is_same<decltype(std::declval<I64>() * 3_c), I64>::value, "");
+
+// compares the operations with the constant with the ones of safe_int for all int8-values:
+template<typename Tconstant>
+void compare_i08(Tconstant constant){
+	const I08_sat c{constant.get_value()};
+	for(int i = -128; i < 128; ++i){
+		const I08_sat value{static_cast<std::int8_t>(i)};
+		assert(value + constant == value + c);
+		assert(value - constant == value - c);
+		assert(value * constant == value * c);
+		assert(constant + value == c + value);
+		assert(constant * value == c * value);
+		bool failed = false;
+		try{ I08{value.get_value()} * I08{c.get_value()}; }
+		catch(std::overflow_error&){ failed = true; }
+		bool constant_failed = false;
+		try{ I08{value.get_value()} * Tconstant{}; }
+		catch(std::overflow_error&){ constant_failed = true; }
+		assert(failed == constant_failed);
+	}
+}
+
+template<typename Tconstant>
+void compare_i08_division(Tconstant constant){
+	compare_i08(constant);
+	const I08_sat c{constant.get_value()};
+	for(int i = -128; i < 128; ++i){
+		const I08_sat value{static_cast<std::int8_t>(i)};
+		assert(value / constant == value / c);
+		assert(value % constant == value % c);
+	}
+}
+
+int main(){
+	compare_i08(c08<0>{});
+	compare_i08_division(c08<1>{});
+	compare_i08_division(c08<-1>{});
+	compare_i08_division(c08<2>{});
+	compare_i08_division(c08<-2>{});
+	compare_i08_division(c08<3>{});
+	compare_i08_division(c08<-7>{});
+	compare_i08_division(c08<127>{});
+	compare_i08_division(c08<-128>{});
+
+	for(int i = 0; i < 256; ++i){
+		const U08_sat value{static_cast<std::uint8_t>(i)};
+		assert(value * cu08<3>{} == value * U08_sat{std::uint8_t{3}});
+		assert(value + cu08<200>{} == value + U08_sat{std::uint8_t{200}});
+		assert(value - cu08<200>{} == value - U08_sat{std::uint8_t{200}});
+		assert(value / cu08<7>{} == value / U08_sat{std::uint8_t{7}});
+	}
+
+	const std::int32_t max = std::numeric_limits<std::int32_t>::max();
+	const std::int32_t min = std::numeric_limits<std::int32_t>::min();
+	ASSERT_THROW_EX(I32{max / 3 + 1} * 3_c, std::overflow_error);
+	ASSERT_THROW_EX(I32{min / 3 - 1} * 3_c, std::overflow_error);
+	ASSERT_THROW_EX(I32{max} + 1_c, std::overflow_error);
+	ASSERT_THROW_EX(I32{min} - 1_c, std::underflow_error);
+	ASSERT_THROW_EX(I32{min} / -1_c, std::overflow_error);
+	// mixed like the operations of two safe_ints:
+	assert(U32{1u} - 2_c == I32{-1});
+	ASSERT_THROW_EX(U32{std::numeric_limits<std::uint32_t>::max()} * 2_c, std::overflow_error);
+	assert(I32{max / 3} * 3_c == I32{max / 3 * 3});
+	assert(I32{min} % -1_c == I32{0});
+	assert(3_c / I32{2} == I32{1});
+	ASSERT_THROW_EX(3_c / I32{0}, std::domain_error);
+
+	I32 value{1000};
+	value *= 1000_c;
+	value /= 7_c;
+	value += 5_c;
+	value -= 10_c;
+	value %= 1000_c;
+	assert(value == I32{(1000 * 1000 / 7 + 5 - 10) % 1000});
+	I08 small{std::int8_t{100}};
+	ASSERT_THROW_EX(small *= 2_c, std::out_of_range);
+	assert(small == I08{std::int8_t{100}});
+
+	// constants can be used where a safe_int is expected:
+	const I32 converted = 1000_c;
+	assert(converted == I32{1000});
+}
@@ -0,0 +1,149 @@
+#include "../include/safe_int_parallel.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+using I16 = type_builder::safe_int<std::int16_t>;
+using U16 = type_builder::safe_int<std::uint16_t>;
+using I32 = type_builder::safe_int<std::int32_t>;
+using I64 = type_builder::safe_int<std::int64_t>;
+using I32_sat = type_builder::safe_int<std::int32_t, type_builder::saturate_on_error>;
+using I16_wrap = type_builder::safe_int<std::int16_t, type_builder::wrap_on_error>;
+
+using type_builder::parallel_reduce;
+using type_builder::parallel_inclusive_scan;
+using type_builder::parallel_exclusive_scan;
+using type_builder::make_span;
+
+// the sequential fold that the parallel versions have to match:
+template<typename T>
+std::vector<T> sequential_inclusive_scan(const std::vector<T>& values, T init){
+	std::vector<T> result;
+	for(const auto& value: values){
+		init = init + value;
+		result.push_back(init);
+	}
+	return result;
+}
+
+template<typename T>
+void compare_with_sequential(const std::vector<T>& values, T init){
+	const auto expected = sequential_inclusive_scan(values, init);
+	for(unsigned threads = 1; threads <= 8; threads *= 2){
+		std::vector<T> out(values.size());
+		const auto reduced = parallel_reduce(values, init, threads);
+		assert(reduced.value == expected.back());
+		const auto result = parallel_inclusive_scan(values, make_span(out), init, threads);
+		assert(result.value == expected.back());
+		assert(reduced.first_error == result.first_error);
+		assert(reduced.errors == result.errors);
+		assert(out == expected);
+		
+		parallel_exclusive_scan(values, make_span(out), init, threads);
+		assert(out[0] == init);
+		assert(std::equal(expected.begin(), expected.end() - 1, out.begin() + 1));
+	}
+}
+
+int main(){
+	const std::size_t size = 1 << 18;
+	std::vector<I32> values(size);
+	for(std::size_t i = 0; i < size; ++i){
+		values[i] = I32(static_cast<std::int32_t>(i % 1000) - 400);
+	}
+	compare_with_sequential(values, I32(0));
+	compare_with_sequential(values, I32(std::numeric_limits<std::int32_t>::min() / 2));
+	
+	// an overflow in the middle of the third quarter is found exactly:
+	const std::size_t bad = size / 2 + size / 8 + 3;
+	const auto expected = sequential_inclusive_scan(values, I32(0));
+	values[bad] = I32(std::numeric_limits<std::int32_t>::max());
+	for(unsigned threads = 1; threads <= 8; threads *= 2){
+		try{
+			parallel_reduce(values, I32(0), threads);
+			assert(false);
+		}
+		catch(std::overflow_error& e){
+			char index[32];
+			std::snprintf(index, sizeof(index), "%lu", static_cast<unsigned long>(bad));
+			assert(std::strstr(e.what(), index));
+		}
+		std::vector<I32> out(size, I32(0));
+		try{
+			parallel_inclusive_scan(values, make_span(out), I32(0), threads);
+			assert(false);
+		}
+		catch(std::overflow_error&){}
+		assert(std::equal(out.begin(), out.begin() + bad, expected.begin()));
+		assert(out[bad] == I32(0));
+	}
+	
+	// other policies see every error in order:
+	std::vector<I32_sat> saturated(values.begin(), values.end());
+	for(std::size_t i = 0; i < size; ++i){
+		saturated[i] = I32_sat(values[i].get_value());
+	}
+	saturated[size - 5] = I32_sat(std::numeric_limits<std::int32_t>::min());
+	compare_with_sequential(saturated, I32_sat(0));
+	const auto result = parallel_reduce(saturated, I32_sat(0), 4);
+	assert(result.first_error == bad);
+	assert(!result.ok());
+	
+	std::vector<I16_wrap> wrapped(size, I16_wrap(1000));
+	compare_with_sequential(wrapped, I16_wrap(0));
+	
+	// a partial sum may leave the range for a long time only before the error:
+	std::vector<I16> small(size, I16(1));
+	for(std::size_t i = 0; i < size; i += 2){
+		small[i] = I16(-1);
+	}
+	compare_with_sequential(small, I16(std::numeric_limits<std::int16_t>::max()));
+	std::vector<U16> unsigned_values(size, U16(0));
+	unsigned_values[size - 1] = U16(1);
+	compare_with_sequential(unsigned_values, U16(65534));
+	
+	// in place:
+	std::vector<I32> in_place(size, I32(1));
+	parallel_inclusive_scan(in_place, make_span(in_place), I32(0), 4);
+	assert(in_place.back() == I32(static_cast<std::int32_t>(size)));
+	in_place.assign(size, I32(1));
+	parallel_exclusive_scan(in_place, make_span(in_place), I32(0), 4);
+	assert(in_place.back() == I32(static_cast<std::int32_t>(size - 1)));
+	
+	// 64 bit integers are summed in 128 bits:
+	std::vector<I64> big(size, I64(std::int64_t{1} << 40));
+	big[size / 2] = I64(std::numeric_limits<std::int64_t>::max());
+	compare_with_sequential(big, I64(std::numeric_limits<std::int64_t>::min()));
+	big[size / 2] = I64(std::int64_t{1} << 40);
+	assert(parallel_reduce(big, I64(0), 4).value == I64(static_cast<std::int64_t>(size) << 40));
+	
+	std::vector<I32> empty;
+	assert(parallel_reduce(empty, I32(3)).value == I32(3));
+	try{ parallel_inclusive_scan(values, make_span(empty)); assert(false); }
+	catch(std::length_error&){}
+	
+	// the threads are joined if the chunk of the calling thread throws:
+	std::atomic<int> done{0};
+	try{
+		type_builder::impl::for_each_chunk(400, 4, 4, [&done](std::size_t chunk, std::size_t, std::size_t){
+			if(chunk == 3){
+				throw std::runtime_error{"chunk"};
+			}
+			++done;
+		});
+		assert(false);
+	}
+	catch(std::runtime_error&){}
+	assert(done == 3);
+}
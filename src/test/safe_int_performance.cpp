@@ -0,0 +1,407 @@
+#include "../include/basic_number.hpp"
+#include "../include/basic_number_atomic.hpp"
+#include "../include/basic_number_overflow.hpp"
+#include "../include/promoting_int.hpp"
+#include "../include/safe_int.hpp"
+#include "../include/safe_int_batch.hpp"
+#include "../include/safe_int_constant.hpp"
+#include "../include/safe_int_divisor.hpp"
+#include "../include/safe_accumulator.hpp"
+#include "../include/safe_int_parallel.hpp"
+#include "../include/safe_int_range.hpp"
+#include "../include/sharded_counter.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using I32 = type_builder::safe_int<int>;
+
+struct counter_t{};
+using checked_counter = type_builder::basic_number<std::int64_t, counter_t,
+	type_builder::DEFAULT_SETTINGS | type_builder::ENABLE_LATE_ASSIGNEMENT
+		| type_builder::ENABLE_OVERFLOW_CHECK>;
+using nested_counter = type_builder::basic_number<type_builder::safe_int<std::int64_t>, counter_t,
+	type_builder::DEFAULT_SETTINGS | type_builder::ENABLE_LATE_ASSIGNEMENT>;
+using plain_counter = type_builder::basic_number<std::int64_t, counter_t, type_builder::DEFAULT_SETTINGS>;
+
+// runs function(n / count) on count threads:
+template<typename Tfunction>
+static void on_threads(int n, unsigned count, Tfunction function){
+	std::vector<std::thread> threads;
+	for(unsigned i = 0; i < count; ++i){
+		threads.emplace_back(function, n / static_cast<int>(count));
+	}
+	for(auto& thread: threads){
+		thread.join();
+	}
+}
+
+// adds n values to a shared counter, split over count threads:
+template<typename T>
+static T contend(int n, unsigned count, T step){
+	std::atomic<T> counter{T{0}};
+	on_threads(n, count, [&counter, step](int m){
+		for(int j = 0; j < m; ++j){
+			counter.fetch_add(step, std::memory_order_relaxed);
+		}
+	});
+	return counter.load();
+}
+
+// the same with a shard of the counter for every thread:
+static plain_counter shard(int n, unsigned count, plain_counter step){
+	type_builder::sharded_counter<plain_counter> counter{count};
+	on_threads(n, count, [&counter, step](int m){
+		for(int j = 0; j < m; ++j){
+			counter.add(step);
+		}
+	});
+	return counter.load();
+}
+
+// sums up the values of a counter that wraps at limit:
+template<typename T>
+static T count(int n, T limit){
+	T total{0}, value{0};
+	for(int i=0; i<n; ++i){
+		total += value;
+		++value;
+		if(value == limit){
+			value = T{0};
+		}
+	}
+	return total;
+}
+
+// usage: safe_int_performance <mode> <iterations> [<threads>]
+// 'm': raw int multiplication, 'M': checked multiplication with safe_int
+// 'a': raw int addition, 'A': checked addition with safe_int
+// 'v': raw int addition of arrays, 'V': checked_add on arrays of safe_int,
+// 'S': loop over the scalar addition of safe_int on arrays
+// 'r': raw sum of an int-array, 'R': checked_sum of a safe_int-array,
+// 'T': loop over += of safe_int on an array
+// 'p': sequential fold with safe_int::operator+ over an array of 2^24 elements,
+// 'P': parallel_reduce over the same array
+// 'c': raw conversion of a double-array into int16_t, 'C': checked_convert of it
+// into safe_int<int16_t>, 'D': loop over the converting constructor from int64_t
+// 'E': checked_convert of an int64_t-array
+// 'k': scaling of a safe_int-array with safe_int-factors that are only known at
+// runtime, 'K': the same with safe_int_constants
+// 'l': loop with a safe_int-index over every second element of an array, 'L':
+// the same loop over a checked_range
+// 'g': dot-product of safe_int<int64_t>-arrays, 'G': the same with promoting_ints
+// whose values stay small
+// 'b': safe_int-division and modulo by a bucket-size that is only known at runtime,
+// 'B': the same with a divisor of it
+// 'o': raw int64_t counter, 'O': a basic_number with ENABLE_OVERFLOW_CHECK, 'N': a
+// basic_number of a safe_int
+// 'x': relaxed fetch_add on a shared std::atomic<int64_t> from threads threads (by
+// default one per core), 'X': the same on a std::atomic of a basic_number, 'Y': on
+// one with ENABLE_OVERFLOW_CHECK, whose fetch_add is a loop of compare_exchange_weak,
+// 'Z': add on a sharded_counter of the basic_number; running them with 1 to N
+// threads shows how they scale
+int main(int argc, char** argv){
+	if(argc != 3 && argc != 4){
+		return 1;
+	}
+	const unsigned threads = (argc == 4) ? static_cast<unsigned>(atoi(argv[3])) :
+		(std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1);
+	int n = atoi(argv[2]);
+	// the factor depends on the runtime-arguments so that it cannot be folded
+	// (argv[1][1] is the terminating zero for all valid modes):
+	int factor = 3 + argv[1][1];
+	if(argv[1][0] == 'm'){
+		int a(1), b(factor);
+		for(int i=0; i<n; ++i){
+			a = (a * b) & 0xffff;
+			b = (b * a) & 0xff;
+		}
+		printf("int: %d\n", a + b);
+	}
+	else if(argv[1][0] == 'M'){
+		I32 a(1), b(factor);
+		const I32 mask_a{0xffff}, mask_b{0xff};
+		for(int i=0; i<n; ++i){
+			a = (a * b) & mask_a;
+			b = (b * a) & mask_b;
+		}
+		printf("safe_int: %d\n", (a + b).get_value());
+	}
+	else if(argv[1][0] == 'a'){
+		int a(1), b(factor);
+		for(int i=0; i<n; ++i){
+			a = (a + b) & 0xffff;
+			b = (b + a) & 0xff;
+		}
+		printf("int: %d\n", a + b);
+	}
+	else if(argv[1][0] == 'A'){
+		I32 a(1), b(factor);
+		const I32 mask_a{0xffff}, mask_b{0xff};
+		for(int i=0; i<n; ++i){
+			a = (a + b) & mask_a;
+			b = (b + a) & mask_b;
+		}
+		printf("safe_int: %d\n", (a + b).get_value());
+	}
+	else if(argv[1][0] == 'v' || argv[1][0] == 'V' || argv[1][0] == 'S'){
+		// n additions on arrays of 4096 elements:
+		const std::size_t size = 4096;
+		std::vector<int> a(size), b(size);
+		for(std::size_t i = 0; i < size; ++i){
+			a[i] = static_cast<int>(i) * factor;
+			b[i] = -static_cast<int>(i);
+		}
+		std::vector<I32> sa(a.begin(), a.end()), sb(b.begin(), b.end());
+		for(int i = 0; i < n / static_cast<int>(size); ++i){
+			if(argv[1][0] == 'v'){
+				for(std::size_t j = 0; j < size; ++j){
+					a[j] = a[j] + b[j];
+				}
+			}
+			else if(argv[1][0] == 'V'){
+				type_builder::checked_add(sa, sb, type_builder::make_span(sa));
+			}
+			else{
+				for(std::size_t j = 0; j < size; ++j){
+					sa[j] = sa[j] + sb[j];
+				}
+			}
+		}
+		printf("arrays: %d\n", a[size - 1] + sa[size - 1].get_value());
+	}
+	else if(argv[1][0] == 'r' || argv[1][0] == 'R' || argv[1][0] == 'T'){
+		// n additions in sums of arrays of 4096 elements:
+		const std::size_t size = 4096;
+		std::vector<int> a(size);
+		for(std::size_t i = 0; i < size; ++i){
+			a[i] = static_cast<int>(i % 16) * factor - 30;
+		}
+		std::vector<I32> sa(a.begin(), a.end());
+		long long total = 0;
+		for(int i = 0; i < n / static_cast<int>(size); ++i){
+			a[i % size] += 1;
+			sa[i % size] += I32(1);
+			if(argv[1][0] == 'r'){
+				int sum = 0;
+				for(std::size_t j = 0; j < size; ++j){
+					sum += a[j];
+				}
+				total += sum;
+			}
+			else if(argv[1][0] == 'R'){
+				total += type_builder::checked_sum(sa).get_value();
+			}
+			else{
+				I32 sum{0};
+				for(std::size_t j = 0; j < size; ++j){
+					sum += sa[j];
+				}
+				total += sum.get_value();
+			}
+		}
+		printf("sums: %lld\n", total);
+	}
+	else if(argv[1][0] == 'p' || argv[1][0] == 'P'){
+		const std::size_t size = std::size_t{1} << 24;
+		std::vector<I32> a(size);
+		for(std::size_t i = 0; i < size; ++i){
+			a[i] = I32(static_cast<int>(i % 16) * factor - 30);
+		}
+		long long total = 0;
+		for(int i = 0; i < n / static_cast<int>(size); ++i){
+			a[i % size] += I32(1);
+			if(argv[1][0] == 'p'){
+				I32 sum{0};
+				for(std::size_t j = 0; j < size; ++j){
+					sum = sum + a[j];
+				}
+				total += sum.get_value();
+			}
+			else{
+				total += type_builder::parallel_reduce(a).value.get_value();
+			}
+		}
+		printf("reductions: %lld\n", total);
+	}
+	else if(argv[1][0] == 'c' || argv[1][0] == 'C' || argv[1][0] == 'D' || argv[1][0] == 'E'){
+		// n conversions of arrays of 4096 elements:
+		const std::size_t size = 4096;
+		std::vector<double> d(size);
+		std::vector<long long> l(size);
+		for(std::size_t i = 0; i < size; ++i){
+			l[i] = static_cast<long long>(i % 1000) * factor - 3000;
+			d[i] = static_cast<double>(l[i]);
+		}
+		std::vector<short> raw(size);
+		std::vector<type_builder::safe_int<short>> out(size);
+		long long total = 0;
+		for(int i = 0; i < n / static_cast<int>(size); ++i){
+			d[i % size] += 1;
+			l[i % size] += 1;
+			if(argv[1][0] == 'c'){
+				for(std::size_t j = 0; j < size; ++j){
+					raw[j] = static_cast<short>(d[j]);
+				}
+				total += raw[i % size];
+			}
+			else if(argv[1][0] == 'C'){
+				type_builder::checked_convert(d, type_builder::make_span(out));
+				total += out[i % size].get_value();
+			}
+			else if(argv[1][0] == 'D'){
+				for(std::size_t j = 0; j < size; ++j){
+					out[j] = type_builder::safe_int<short>(l[j]);
+				}
+				total += out[i % size].get_value();
+			}
+			else{
+				type_builder::checked_convert(l, type_builder::make_span(out));
+				total += out[i % size].get_value();
+			}
+		}
+		printf("conversions: %lld\n", total);
+	}
+	else if(argv[1][0] == 'k' || argv[1][0] == 'K'){
+		// n scalings of elements of an array of 4096 elements:
+		using namespace type_builder::literals;
+		const std::size_t size = 4096;
+		std::vector<I32> a(size);
+		for(std::size_t i = 0; i < size; ++i){
+			a[i] = I32(static_cast<int>(i) * factor);
+		}
+		long long total = 0;
+		for(int i = 0; i < n / static_cast<int>(size); ++i){
+			a[i % size] += I32(1);
+			if(argv[1][0] == 'k'){
+				// factors that are only known at runtime (factor - 3 is 0):
+				const I32 scale(997 + factor), divisor(4 + factor), offset(factor);
+				for(std::size_t j = 0; j < size; ++j){
+					total += (a[j] * scale / divisor + offset).get_value();
+				}
+			}
+			else{
+				for(std::size_t j = 0; j < size; ++j){
+					total += (a[j] * 1000_c / 7_c + 3_c).get_value();
+				}
+			}
+		}
+		printf("scalings: %lld\n", total);
+	}
+	else if(argv[1][0] == 'l' || argv[1][0] == 'L'){
+		// n iterations of loops over 4096 elements:
+		const int size = 4096;
+		std::vector<int> a(2 * size + 1);
+		for(int i = 0; i < 2 * size + 1; ++i){
+			a[i] = i * factor;
+		}
+		long long total = 0;
+		for(int i = 0; i < n / size; ++i){
+			a[i % size] += 1;
+			int sum = 0;
+			if(argv[1][0] == 'l'){
+				for(I32 j{0}; j < I32(size); ++j){
+					sum += a[(j * I32(2) + I32(1)).get_value()];
+				}
+			}
+			else{
+				for(int j: type_builder::checked_range(0, size).validate(2, 1)){
+					sum += a[j * 2 + 1];
+				}
+			}
+			total += sum;
+		}
+		printf("loops: %lld\n", total);
+	}
+	else if(argv[1][0] == 'g' || argv[1][0] == 'G'){
+		// n multiply-adds of arrays of 4096 elements:
+		using I64 = type_builder::safe_int<std::int64_t>;
+		using P = type_builder::promoting_int<>;
+		const std::size_t size = 4096;
+		std::vector<I64> a(size);
+		std::vector<P> b(size);
+		for(std::size_t i = 0; i < size; ++i){
+			a[i] = I64(static_cast<std::int64_t>(i) * factor);
+			b[i] = P(static_cast<std::int64_t>(i) * factor);
+		}
+		long long total = 0;
+		for(int i = 0; i < n / static_cast<int>(size); ++i){
+			if(argv[1][0] == 'g'){
+				a[i % size] += I64(1);
+				I64 sum{0};
+				for(std::size_t j = 0; j < size; ++j){
+					sum += a[j] * a[size - 1 - j];
+				}
+				total += sum.get_value();
+			}
+			else{
+				b[i % size] += P(1);
+				P sum{0};
+				for(std::size_t j = 0; j < size; ++j){
+					sum += b[j] * b[size - 1 - j];
+				}
+				total += sum.narrow<std::int64_t>().get_value();
+			}
+		}
+		printf("dot-products: %lld\n", total);
+	}
+	else if(argv[1][0] == 'b' || argv[1][0] == 'B'){
+		// n divisions and modulos of elements of an array of 4096 elements:
+		const std::size_t size = 4096;
+		std::vector<I32> a(size);
+		for(std::size_t i = 0; i < size; ++i){
+			a[i] = I32(static_cast<int>(i * 2654435761u >> 1) / factor);
+		}
+		const I32 buckets(1021 + factor);
+		const type_builder::divisor<I32> bucket_divisor{buckets};
+		long long total = 0;
+		for(int i = 0; i < n / static_cast<int>(size); ++i){
+			a[i % size] += I32(1);
+			if(argv[1][0] == 'b'){
+				for(std::size_t j = 0; j < size; ++j){
+					total += (a[j] / buckets + a[j] % buckets).get_value();
+				}
+			}
+			else{
+				for(std::size_t j = 0; j < size; ++j){
+					total += (a[j] / bucket_divisor + a[j] % bucket_divisor).get_value();
+				}
+			}
+		}
+		printf("buckets: %lld\n", total);
+	}
+	else if(argv[1][0] == 'o'){
+		const std::int64_t total = count<std::int64_t>(n, 1000 * factor);
+		printf("int64_t: %lld\n", static_cast<long long>(total));
+	}
+	else if(argv[1][0] == 'O'){
+		const checked_counter total = count(n, checked_counter{1000 * factor});
+		printf("checked basic_number: %lld\n", static_cast<long long>(total.get_value()));
+	}
+	else if(argv[1][0] == 'N'){
+		const nested_counter total = count(n,
+			nested_counter{type_builder::safe_int<std::int64_t>{1000 * factor}});
+		printf("basic_number of safe_int: %lld\n",
+			static_cast<long long>(total.get_value().get_value()));
+	}
+	else if(argv[1][0] == 'x'){
+		const std::int64_t total = contend<std::int64_t>(n, threads, factor);
+		printf("atomic int64_t: %lld\n", static_cast<long long>(total));
+	}
+	else if(argv[1][0] == 'X'){
+		const plain_counter total = contend(n, threads, plain_counter{factor});
+		printf("atomic basic_number: %lld\n", static_cast<long long>(total.get_value()));
+	}
+	else if(argv[1][0] == 'Y'){
+		const checked_counter total = contend(n, threads, checked_counter{factor});
+		printf("atomic checked basic_number: %lld\n", static_cast<long long>(total.get_value()));
+	}
+	else if(argv[1][0] == 'Z'){
+		const plain_counter total = shard(n, threads, plain_counter{factor});
+		printf("sharded basic_number: %lld\n", static_cast<long long>(total.get_value()));
+	}
+	else return 2;
+}
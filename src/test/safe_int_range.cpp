@@ -0,0 +1,95 @@
+#include "../include/safe_int_range.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+using I08 = type_builder::safe_int<std::int8_t>;
+using U08 = type_builder::safe_int<std::uint8_t>;
+using I32 = type_builder::safe_int<std::int32_t>;
+using I08_sat = type_builder::safe_int<std::int8_t, type_builder::saturate_on_error>;
+
+using type_builder::checked_range;
+
+#define ASSERT_THROW_EX(expr, exception) \
+	do{ try{ expr; assert(false); } catch (exception& e){ assert(true); } }while(false)
+
+template<typename Trange>
+std::vector<int> values(const Trange& range){
+	std::vector<int> result;
+	for(auto value: range){
+		result.push_back(value);
+	}
+	assert(result.size() == range.size());
+	return result;
+}
+
+// compares the ranges with the loops they replace for all int8-bounds:
+void test_exhaustive_i08(){
+	const int strides[] = {1, 2, 3, 7, 100, 127, -1, -2, -5, -128};
+	for(int stride: strides){
+		for(int begin = -128; begin < 128; begin += 3){
+			for(int end = -128; end < 128; end += 5){
+				std::vector<int> expected;
+				for(int i = begin; stride > 0 ? i < end : i > end; i += stride){
+					expected.push_back(i);
+				}
+				const auto range = checked_range(static_cast<std::int8_t>(begin),
+					static_cast<std::int8_t>(end), static_cast<std::int8_t>(stride));
+				assert(values(range) == expected);
+				if(!expected.empty()){
+					assert(range.first() == expected.front());
+					assert(range.last() == expected.back());
+				}
+			}
+		}
+	}
+}
+
+int main(){
+	test_exhaustive_i08();
+
+	assert(values(checked_range(0, 5)) == (std::vector<int>{0, 1, 2, 3, 4}));
+	assert(values(checked_range(I32{10}, 0, -3)) == (std::vector<int>{10, 7, 4, 1}));
+	assert(checked_range(5, 5).empty());
+	assert(checked_range(5, 0).empty());
+	ASSERT_THROW_EX(checked_range(0, 5, 0), std::domain_error);
+
+	// the ranges reach the ends of the type without overflowing:
+	assert(checked_range(std::uint8_t{250}, std::uint8_t{255}, std::uint8_t{2}).size() == 3);
+	assert(checked_range(std::int8_t{-128}, std::int8_t{127}).size() == 255);
+	const auto top = checked_range(std::numeric_limits<int>::max() - 4, std::numeric_limits<int>::max(), 3);
+	assert(values(top) == (std::vector<int>{std::numeric_limits<int>::max() - 4,
+		std::numeric_limits<int>::max() - 1}));
+
+	// affine maps are checked once:
+	const auto range = checked_range(I32{0}, 1000, 2);
+	assert(values(range.validate(3, 1)) == values(range));
+	std::vector<int> mapped;
+	for(int i: range){
+		mapped.push_back(i * 3 + 1);
+	}
+	assert(values(range.affine(3, 1)) == mapped);
+	assert(values(range.affine(-3, 1)).back() == -998 * 3 + 1);
+	assert(values(range.validate(1000000, 5)).size() == 500);
+	ASSERT_THROW_EX(range.validate(10000000), std::overflow_error);
+	ASSERT_THROW_EX(range.affine(1, std::numeric_limits<int>::max() - 997), std::overflow_error);
+	assert(range.affine(1, std::numeric_limits<int>::max() - 998).last() == std::numeric_limits<int>::max());
+
+	// the image of a map may have steps that don't fit into the type:
+	const auto wide = checked_range(std::int8_t{-1}, std::int8_t{2}, std::int8_t{2}).affine(I08{std::int8_t{127}}, I08{});
+	assert(values(wide) == (std::vector<int>{-127, 127}));
+
+	// policies that don't throw leave the range empty:
+	const auto saturated = checked_range(I08_sat{std::int8_t{0}}, std::int8_t{100});
+	assert(saturated.size() == 100);
+	assert(saturated.validate(std::int8_t{2}).empty());
+	assert(saturated.validate(std::int8_t{1}, std::int8_t{28}).size() == 100);
+	assert(checked_range(I08_sat{std::int8_t{0}}, std::int8_t{100}, std::int8_t{0}).empty());
+}
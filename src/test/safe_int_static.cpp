@@ -1,4 +1,5 @@
 #include "../include/safe_int.hpp"
+#include "../include/widening_safe_int.hpp"
 
 #include <cstdlib>
 #include <iostream>
@@ -15,6 +16,7 @@ using I08 = ui<std::int8_t>;
 using I16 = ui<std::int16_t>;
 using I32 = ui<std::int32_t>;
 using I64 = ui<std::int64_t>;
+using I128 = ui<type_builder::int128_t>;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -25,7 +27,7 @@ static_assert(std::is_same<decltype(std::declval<I08>() + std::declval<I64>()),I
 static_assert(std::is_same<decltype(std::declval<I08>() + std::declval<U08>()),I08>::value, "");
 static_assert(std::is_same<decltype(std::declval<I08>() + std::declval<U16>()),I16>::value, "");
 static_assert(std::is_same<decltype(std::declval<I08>() + std::declval<U32>()),I32>::value, "");
-static_assert(std::is_same<decltype(std::declval<I08>() + std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I08>() + std::declval<U64>()),I128>::value, "");
 
 static_assert(std::is_same<decltype(std::declval<U08>() + std::declval<I08>()),I08>::value, "");
 static_assert(std::is_same<decltype(std::declval<U08>() + std::declval<I16>()),I16>::value, "");
@@ -42,7 +44,7 @@ static_assert(std::is_same<decltype(std::declval<I16>() + std::declval<I32>()),I
 static_assert(std::is_same<decltype(std::declval<I16>() + std::declval<I64>()),I64>::value, "");
 static_assert(std::is_same<decltype(std::declval<I16>() + std::declval<U16>()),I16>::value, "");
 static_assert(std::is_same<decltype(std::declval<I16>() + std::declval<U32>()),I32>::value, "");
-static_assert(std::is_same<decltype(std::declval<I16>() + std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I16>() + std::declval<U64>()),I128>::value, "");
 
 static_assert(std::is_same<decltype(std::declval<U16>() + std::declval<I16>()),I16>::value, "");
 static_assert(std::is_same<decltype(std::declval<U16>() + std::declval<I32>()),I32>::value, "");
@@ -55,7 +57,7 @@ static_assert(std::is_same<decltype(std::declval<U16>() + std::declval<U64>()),U
 static_assert(std::is_same<decltype(std::declval<I32>() + std::declval<I32>()),I32>::value, "");
 static_assert(std::is_same<decltype(std::declval<I32>() + std::declval<I64>()),I64>::value, "");
 static_assert(std::is_same<decltype(std::declval<I32>() + std::declval<U32>()),I32>::value, "");
-static_assert(std::is_same<decltype(std::declval<I32>() + std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I32>() + std::declval<U64>()),I128>::value, "");
 
 static_assert(std::is_same<decltype(std::declval<U32>() + std::declval<I32>()),I32>::value, "");
 static_assert(std::is_same<decltype(std::declval<U32>() + std::declval<I64>()),I64>::value, "");
@@ -64,9 +66,9 @@ static_assert(std::is_same<decltype(std::declval<U32>() + std::declval<U64>()),U
 
 
 static_assert(std::is_same<decltype(std::declval<I64>() + std::declval<I64>()),I64>::value, "");
-static_assert(std::is_same<decltype(std::declval<I64>() + std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I64>() + std::declval<U64>()),I128>::value, "");
 
-static_assert(std::is_same<decltype(std::declval<U64>() + std::declval<I64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<U64>() + std::declval<I64>()),I128>::value, "");
 static_assert(std::is_same<decltype(std::declval<U64>() + std::declval<U64>()),U64>::value, "");
 
 
@@ -79,7 +81,7 @@ static_assert(std::is_same<decltype(std::declval<I08>() - std::declval<I64>()),I
 static_assert(std::is_same<decltype(std::declval<I08>() - std::declval<U08>()),I08>::value, "");
 static_assert(std::is_same<decltype(std::declval<I08>() - std::declval<U16>()),I16>::value, "");
 static_assert(std::is_same<decltype(std::declval<I08>() - std::declval<U32>()),I32>::value, "");
-static_assert(std::is_same<decltype(std::declval<I08>() - std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I08>() - std::declval<U64>()),I128>::value, "");
 
 static_assert(std::is_same<decltype(std::declval<U08>() - std::declval<I08>()),I08>::value, "");
 static_assert(std::is_same<decltype(std::declval<U08>() - std::declval<I16>()),I16>::value, "");
@@ -96,7 +98,7 @@ static_assert(std::is_same<decltype(std::declval<I16>() - std::declval<I32>()),I
 static_assert(std::is_same<decltype(std::declval<I16>() - std::declval<I64>()),I64>::value, "");
 static_assert(std::is_same<decltype(std::declval<I16>() - std::declval<U16>()),I16>::value, "");
 static_assert(std::is_same<decltype(std::declval<I16>() - std::declval<U32>()),I32>::value, "");
-static_assert(std::is_same<decltype(std::declval<I16>() - std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I16>() - std::declval<U64>()),I128>::value, "");
 
 static_assert(std::is_same<decltype(std::declval<U16>() - std::declval<I16>()),I16>::value, "");
 static_assert(std::is_same<decltype(std::declval<U16>() - std::declval<I32>()),I32>::value, "");
@@ -109,7 +111,7 @@ static_assert(std::is_same<decltype(std::declval<U16>() - std::declval<U64>()),U
 static_assert(std::is_same<decltype(std::declval<I32>() - std::declval<I32>()),I32>::value, "");
 static_assert(std::is_same<decltype(std::declval<I32>() - std::declval<I64>()),I64>::value, "");
 static_assert(std::is_same<decltype(std::declval<I32>() - std::declval<U32>()),I32>::value, "");
-static_assert(std::is_same<decltype(std::declval<I32>() - std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I32>() - std::declval<U64>()),I128>::value, "");
 
 static_assert(std::is_same<decltype(std::declval<U32>() - std::declval<I32>()),I32>::value, "");
 static_assert(std::is_same<decltype(std::declval<U32>() - std::declval<I64>()),I64>::value, "");
@@ -118,9 +120,9 @@ static_assert(std::is_same<decltype(std::declval<U32>() - std::declval<U64>()),U
 
 
 static_assert(std::is_same<decltype(std::declval<I64>() - std::declval<I64>()),I64>::value, "");
-static_assert(std::is_same<decltype(std::declval<I64>() - std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I64>() - std::declval<U64>()),I128>::value, "");
 
-static_assert(std::is_same<decltype(std::declval<U64>() - std::declval<I64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<U64>() - std::declval<I64>()),I128>::value, "");
 static_assert(std::is_same<decltype(std::declval<U64>() - std::declval<U64>()),U64>::value, "");
 
 
@@ -133,7 +135,7 @@ static_assert(std::is_same<decltype(std::declval<I08>() * std::declval<I64>()),I
 static_assert(std::is_same<decltype(std::declval<I08>() * std::declval<U08>()),I08>::value, "");
 static_assert(std::is_same<decltype(std::declval<I08>() * std::declval<U16>()),I16>::value, "");
 static_assert(std::is_same<decltype(std::declval<I08>() * std::declval<U32>()),I32>::value, "");
-static_assert(std::is_same<decltype(std::declval<I08>() * std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I08>() * std::declval<U64>()),I128>::value, "");
 
 static_assert(std::is_same<decltype(std::declval<U08>() * std::declval<I08>()),I08>::value, "");
 static_assert(std::is_same<decltype(std::declval<U08>() * std::declval<I16>()),I16>::value, "");
@@ -150,7 +152,7 @@ static_assert(std::is_same<decltype(std::declval<I16>() * std::declval<I32>()),I
 static_assert(std::is_same<decltype(std::declval<I16>() * std::declval<I64>()),I64>::value, "");
 static_assert(std::is_same<decltype(std::declval<I16>() * std::declval<U16>()),I16>::value, "");
 static_assert(std::is_same<decltype(std::declval<I16>() * std::declval<U32>()),I32>::value, "");
-static_assert(std::is_same<decltype(std::declval<I16>() * std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I16>() * std::declval<U64>()),I128>::value, "");
 
 static_assert(std::is_same<decltype(std::declval<U16>() * std::declval<I16>()),I16>::value, "");
 static_assert(std::is_same<decltype(std::declval<U16>() * std::declval<I32>()),I32>::value, "");
@@ -163,7 +165,7 @@ static_assert(std::is_same<decltype(std::declval<U16>() * std::declval<U64>()),U
 static_assert(std::is_same<decltype(std::declval<I32>() * std::declval<I32>()),I32>::value, "");
 static_assert(std::is_same<decltype(std::declval<I32>() * std::declval<I64>()),I64>::value, "");
 static_assert(std::is_same<decltype(std::declval<I32>() * std::declval<U32>()),I32>::value, "");
-static_assert(std::is_same<decltype(std::declval<I32>() * std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I32>() * std::declval<U64>()),I128>::value, "");
 
 static_assert(std::is_same<decltype(std::declval<U32>() * std::declval<I32>()),I32>::value, "");
 static_assert(std::is_same<decltype(std::declval<U32>() * std::declval<I64>()),I64>::value, "");
@@ -172,9 +174,9 @@ static_assert(std::is_same<decltype(std::declval<U32>() * std::declval<U64>()),U
 
 
 static_assert(std::is_same<decltype(std::declval<I64>() * std::declval<I64>()),I64>::value, "");
-static_assert(std::is_same<decltype(std::declval<I64>() * std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I64>() * std::declval<U64>()),I128>::value, "");
 
-static_assert(std::is_same<decltype(std::declval<U64>() * std::declval<I64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<U64>() * std::declval<I64>()),I128>::value, "");
 static_assert(std::is_same<decltype(std::declval<U64>() * std::declval<U64>()),U64>::value, "");
 
 
@@ -187,7 +189,7 @@ static_assert(std::is_same<decltype(std::declval<I08>() / std::declval<I64>()),I
 static_assert(std::is_same<decltype(std::declval<I08>() / std::declval<U08>()),I08>::value, "");
 static_assert(std::is_same<decltype(std::declval<I08>() / std::declval<U16>()),I16>::value, "");
 static_assert(std::is_same<decltype(std::declval<I08>() / std::declval<U32>()),I32>::value, "");
-static_assert(std::is_same<decltype(std::declval<I08>() / std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I08>() / std::declval<U64>()),I128>::value, "");
 
 static_assert(std::is_same<decltype(std::declval<U08>() / std::declval<I08>()),I08>::value, "");
 static_assert(std::is_same<decltype(std::declval<U08>() / std::declval<I16>()),I16>::value, "");
@@ -204,7 +206,7 @@ static_assert(std::is_same<decltype(std::declval<I16>() / std::declval<I32>()),I
 static_assert(std::is_same<decltype(std::declval<I16>() / std::declval<I64>()),I64>::value, "");
 static_assert(std::is_same<decltype(std::declval<I16>() / std::declval<U16>()),I16>::value, "");
 static_assert(std::is_same<decltype(std::declval<I16>() / std::declval<U32>()),I32>::value, "");
-static_assert(std::is_same<decltype(std::declval<I16>() / std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I16>() / std::declval<U64>()),I128>::value, "");
 
 static_assert(std::is_same<decltype(std::declval<U16>() / std::declval<I16>()),I16>::value, "");
 static_assert(std::is_same<decltype(std::declval<U16>() / std::declval<I32>()),I32>::value, "");
@@ -217,7 +219,7 @@ static_assert(std::is_same<decltype(std::declval<U16>() / std::declval<U64>()),U
 static_assert(std::is_same<decltype(std::declval<I32>() / std::declval<I32>()),I32>::value, "");
 static_assert(std::is_same<decltype(std::declval<I32>() / std::declval<I64>()),I64>::value, "");
 static_assert(std::is_same<decltype(std::declval<I32>() / std::declval<U32>()),I32>::value, "");
-static_assert(std::is_same<decltype(std::declval<I32>() / std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I32>() / std::declval<U64>()),I128>::value, "");
 
 static_assert(std::is_same<decltype(std::declval<U32>() / std::declval<I32>()),I32>::value, "");
 static_assert(std::is_same<decltype(std::declval<U32>() / std::declval<I64>()),I64>::value, "");
@@ -226,9 +228,9 @@ static_assert(std::is_same<decltype(std::declval<U32>() / std::declval<U64>()),U
 
 
 static_assert(std::is_same<decltype(std::declval<I64>() / std::declval<I64>()),I64>::value, "");
-static_assert(std::is_same<decltype(std::declval<I64>() / std::declval<U64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<I64>() / std::declval<U64>()),I128>::value, "");
 
-static_assert(std::is_same<decltype(std::declval<U64>() / std::declval<I64>()),I64>::value, "");
+static_assert(std::is_same<decltype(std::declval<U64>() / std::declval<I64>()),I128>::value, "");
 static_assert(std::is_same<decltype(std::declval<U64>() / std::declval<U64>()),U64>::value, "");
 
 static_assert(std::is_same<decltype(-std::declval<I08>()), I08>::value,"");
@@ -301,4 +303,70 @@ static_assert(static_cast<bool>(U08{static_cast<std::uint8_t>(0)}) == false,"");
 static_assert(static_cast<bool>(!U08{static_cast<std::uint8_t>(1)}) == false,"");
 static_assert(static_cast<bool>(!U08{static_cast<std::uint8_t>(0)}) == true,"");
 
+////////////////////////////////////////////////////////////////////////////////////////////////
+static_assert((I32{2} + I32{3}).get_value() == 5, "");
+static_assert((I32{2} - I32{3}).get_value() == -1, "");
+static_assert((I32{-2} * I32{3}).get_value() == -6, "");
+static_assert((U08{static_cast<std::uint8_t>(15)} * U08{static_cast<std::uint8_t>(17)}).get_value() == 255, "");
+static_assert((-U08{static_cast<std::uint8_t>(127)}).get_value() == -127, "");
+static_assert((-I08{static_cast<std::int8_t>(-127)}).get_value() == 127, "");
+
+using I08_sat = type_builder::safe_int<std::int8_t, type_builder::saturate_on_error>;
+using I08_wrap = type_builder::safe_int<std::int8_t, type_builder::wrap_on_error>;
+
+static_assert((I08_sat{static_cast<std::int8_t>(100)} + I08_sat{static_cast<std::int8_t>(100)}).get_value() == 127, "");
+static_assert((I08_sat{static_cast<std::int8_t>(-100)} * I08_sat{static_cast<std::int8_t>(2)}).get_value() == -128, "");
+static_assert((I08_wrap{static_cast<std::int8_t>(100)} + I08_wrap{static_cast<std::int8_t>(100)}).get_value() == -56, "");
+static_assert(std::is_same<decltype(std::declval<I08_sat>() + std::declval<
+		type_builder::safe_int<std::int16_t, type_builder::saturate_on_error>>()),
+	type_builder::safe_int<std::int16_t, type_builder::saturate_on_error>>::value, "");
+
+// checked conversions from other integers:
+static_assert(I08_sat{300}.get_value() == 127, "");
+static_assert(I08_sat{-300L}.get_value() == -128, "");
+static_assert(I08_sat{200u}.get_value() == 127, "");
+static_assert(U16{65535LL}.get_value() == 65535, "");
+static_assert(type_builder::safe_int<std::uint8_t, type_builder::saturate_on_error>{-1}.get_value() == 0, "");
+static_assert(I64{std::numeric_limits<std::uint64_t>::max() / 2}.get_value()
+	== std::numeric_limits<std::int64_t>::max(), "");
+
+template<typename T>
+using wi = type_builder::widening_safe_int<T>;
+
+using WU08 = wi<std::uint8_t>;
+using WU16 = wi<std::uint16_t>;
+using WU32 = wi<std::uint32_t>;
+using WU64 = wi<std::uint64_t>;
+using WI08 = wi<std::int8_t>;
+using WI16 = wi<std::int16_t>;
+using WI32 = wi<std::int32_t>;
+using WI64 = wi<std::int64_t>;
+
+static_assert(std::is_same<decltype(std::declval<WU08>() + std::declval<WU08>()), WU16>::value, "");
+static_assert(std::is_same<decltype(std::declval<WU08>() - std::declval<WU08>()), WI16>::value, "");
+static_assert(std::is_same<decltype(std::declval<WU08>() * std::declval<WU08>()), WU16>::value, "");
+static_assert(std::is_same<decltype(std::declval<WU08>() + std::declval<WI08>()), WI16>::value, "");
+static_assert(std::is_same<decltype(std::declval<WI08>() * std::declval<WU16>()), WI32>::value, "");
+static_assert(std::is_same<decltype(std::declval<WU16>() * std::declval<WU16>()), WU32>::value, "");
+static_assert(std::is_same<decltype(std::declval<WI32>() * std::declval<WI32>()), WI64>::value, "");
+static_assert(std::is_same<decltype(std::declval<WU32>() - std::declval<WU32>()), WI64>::value, "");
+static_assert(std::is_same<decltype(-std::declval<WU08>()), WI16>::value, "");
+static_assert(std::is_same<decltype(-std::declval<WI08>()), WI16>::value, "");
+static_assert(std::is_same<decltype(std::declval<WU16>() / std::declval<WU08>()), WU16>::value, "");
+
+static_assert((WU08{static_cast<std::uint8_t>(255)} * WU08{static_cast<std::uint8_t>(255)}).get_value() == 65025, "");
+static_assert((WU08{static_cast<std::uint8_t>(0)} - WU08{static_cast<std::uint8_t>(255)}).get_value() == -255, "");
+static_assert((-WI08{static_cast<std::int8_t>(-128)}).get_value() == 128, "");
+static_assert((WI32{INT32_MIN} * WI32{INT32_MIN}).get_value() == 4611686018427387904ll, "");
+
+constexpr I128 i128_max{std::numeric_limits<type_builder::int128_t>::max()};
+constexpr I128 i128_1{type_builder::int128_t{1}};
+static_assert((i128_max - i128_1 + i128_1) == i128_max, "");
+static_assert((I64(std::int64_t{INT64_MIN}) - U64(std::uint64_t{UINT64_MAX})).get_value()
+	== -(type_builder::int128_t{1} << 64) - INT64_MAX, "");
+static_assert(std::is_same<decltype(std::declval<WI64>() * std::declval<WI64>()), wi<type_builder::int128_t>>::value, "");
+static_assert(std::is_same<decltype(std::declval<WU64>() + std::declval<WU64>()), wi<type_builder::uint128_t>>::value, "");
+static_assert(std::is_same<decltype(std::declval<wi<type_builder::int128_t>>() * std::declval<WI64>()),
+	wi<type_builder::int128_t>>::value, "");
+
 int main(){}
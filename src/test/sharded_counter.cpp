@@ -0,0 +1,164 @@
+#include "../include/basic_number.hpp"
+#include "../include/basic_number_overflow.hpp"
+#include "../include/safe_int.hpp"
+#include "../include/sharded_counter.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+
+using type_builder::sharded_counter;
+
+struct requests_t{};
+using requests = type_builder::basic_number<std::int64_t, requests_t,
+	type_builder::DEFAULT_SETTINGS | type_builder::ENABLE_INC_DEC>;
+
+struct small_t{};
+using small = type_builder::basic_number<std::uint8_t, small_t,
+	type_builder::DEFAULT_SETTINGS | type_builder::ENABLE_INC_DEC>;
+
+struct bytes_t{};
+using bytes = type_builder::basic_number<type_builder::safe_int<std::int32_t>, bytes_t,
+	type_builder::DEFAULT_SETTINGS>;
+
+struct stock_t{};
+using stock = type_builder::basic_number<type_builder::safe_int<unsigned>, stock_t,
+	type_builder::DEFAULT_SETTINGS>;
+
+struct traffic_t{};
+using traffic = type_builder::basic_number<type_builder::safe_int<std::uint64_t>, traffic_t,
+	type_builder::DEFAULT_SETTINGS | type_builder::ENABLE_INC_DEC>;
+
+struct level_t{};
+using level = type_builder::basic_number<std::int16_t, level_t,
+	type_builder::DEFAULT_SETTINGS | type_builder::ENABLE_SATURATING_OVERFLOW_CHECK>;
+
+template<typename Tcounter, typename Tfunction>
+static void on_threads(Tcounter& counter, unsigned count, Tfunction function){
+	std::vector<std::thread> threads;
+	for(unsigned i = 0; i < count; ++i){
+		threads.emplace_back([&counter, function]{
+			function(counter);
+		});
+	}
+	for(auto& thread: threads){
+		thread.join();
+	}
+}
+
+int main(){
+	// the shards are rounded up to a power of two:
+	assert(sharded_counter<requests>{3}.shards() == 4);
+	assert(sharded_counter<requests>{1}.shards() == 1);
+	assert(sharded_counter<requests>{}.shards() >= 1);
+
+	sharded_counter<requests> served{4};
+	assert(served.load() == requests{0});
+	served.increment();
+	served.add(requests{10});
+	served.subtract(requests{3});
+	served.decrement();
+	assert(served.load() == requests{7});
+	served.reset();
+	assert(served.load() == requests{0});
+
+	// no increment of any thread is lost, whether they share shards or not:
+	const int iterations = 100000;
+	for(unsigned threads: {1u, 3u, 8u}){
+		sharded_counter<requests> total{4};
+		on_threads(total, threads, [](sharded_counter<requests>& counter){
+			for(int i = 0; i < iterations; ++i){
+				counter.increment();
+			}
+			counter.add(requests{2});
+		});
+		assert(total.load() == requests{std::int64_t{threads} * (iterations + 2)});
+	}
+
+	// unchecked sums wrap around:
+	sharded_counter<small> wrapping{2};
+	for(int i = 0; i < 300; ++i){
+		wrapping.increment();
+	}
+	assert(wrapping.load() == small{std::uint8_t{44}});
+
+	// numbers of safe_ints check the total, but not the shards on their own:
+	sharded_counter<bytes> received{4};
+	const std::int32_t max = std::numeric_limits<std::int32_t>::max();
+	on_threads(received, 4, [max](sharded_counter<bytes>& counter){
+		counter.add(bytes{type_builder::safe_int<std::int32_t>{max / 2}});
+	});
+	bool thrown = false;
+	try{
+		received.load();
+	}
+	catch(std::overflow_error&){
+		thrown = true;
+	}
+	assert(thrown);
+	received.subtract(bytes{type_builder::safe_int<std::int32_t>{max / 2}});
+	received.subtract(bytes{type_builder::safe_int<std::int32_t>{max / 2}});
+	assert(received.load().get_value().get_value() == max / 2 * 2);
+
+	// shards that only subtract don't wrap around, and only the total is checked:
+	sharded_counter<stock> stocks{2};
+	std::thread([&stocks]{ stocks.add(stock{type_builder::safe_int<unsigned>{10u}}); }).join();
+	std::thread([&stocks]{ stocks.subtract(stock{type_builder::safe_int<unsigned>{5u}}); }).join();
+	assert(stocks.load().get_value().get_value() == 5u);
+	std::thread([&stocks]{ stocks.subtract(stock{type_builder::safe_int<unsigned>{6u}}); }).join();
+	thrown = false;
+	try{
+		stocks.load();
+	}
+	catch(std::underflow_error&){
+		thrown = true;
+	}
+	assert(thrown);
+
+	// amounts and totals use the whole range of 64-bit unsigned numbers:
+	using safe_u64 = type_builder::safe_int<std::uint64_t>;
+	const std::uint64_t half = std::uint64_t{1} << 63;
+	sharded_counter<traffic> transferred{1};
+	transferred.add(traffic{safe_u64{half}});
+	assert(transferred.load().get_value().get_value() == half);
+	transferred.add(traffic{safe_u64{half - 1}});
+	assert(transferred.load().get_value().get_value() == std::numeric_limits<std::uint64_t>::max());
+	transferred.subtract(traffic{safe_u64{half}});
+	assert(transferred.load().get_value().get_value() == half - 1);
+	transferred.reset();
+	transferred.subtract(traffic{safe_u64{1u}});
+	thrown = false;
+	try{
+		transferred.load();
+	}
+	catch(std::underflow_error&){
+		thrown = true;
+	}
+	assert(thrown);
+	sharded_counter<traffic> overflowing{2};
+	on_threads(overflowing, 2, [half](sharded_counter<traffic>& counter){
+		counter.add(traffic{safe_u64{half}});
+	});
+	thrown = false;
+	try{
+		overflowing.load();
+	}
+	catch(std::overflow_error&){
+		thrown = true;
+	}
+	assert(thrown);
+
+	// and ENABLE_OVERFLOW_CHECK with the policy of the flags:
+	sharded_counter<level> levels{2};
+	on_threads(levels, 2, [](sharded_counter<level>& counter){
+		counter.add(level{std::int16_t{-30000}});
+	});
+	assert(levels.load() == level{std::numeric_limits<std::int16_t>::min()});
+}